@@ -91,129 +91,161 @@ do
     fi
 
 
-    for j in ${dPhi[@]}
+    #dPhi, multiJtDPhi and mixJtDR values are filled as selection variants in a single pass over the ntuple; first of each is nominal
+    j=${dPhi[0]}
+    k=${multiJtDPhi[0]}
+    n=${mixJtDR[0]}
+
+    drVal=$n
+    if [[ $i == 4 ]] 
+    then
+	drVal=0.8
+    fi
+
+    dPhiName=$(echo $j | sed -e "s@/@Over@g")
+    multiJtDPhiName=$(echo $k | sed -e "s@/@Over@g")
+    mixJtDRName=$(echo $drVal | sed -e "s@\.@p@g")
+    echo " Nominal dPhi=$j, multiJtDPhi=$k, mixJtDR=$drVal"
+
+    selVarNames=""
+    selVarDPhi=""
+    selVarMultiDPhi=""
+    selVarDR=""
+    for jV in ${dPhi[@]}
     do
-	dPhiName=$(echo $j | sed -e "s@/@Over@g")
-	echo " dPhi=$j, $dPhiName"
-	for k in ${multiJtDPhi[@]}
+	for kV in ${multiJtDPhi[@]}
 	do
-	    multiJtDPhiName=$(echo $k | sed -e "s@/@Over@g")
-	    echo "  multiJtDPhi=$k, $multiJtDPhiName"
-
-	    for n in ${mixJtDR[@]}
+	    for nV in ${mixJtDR[@]}
 	    do
-
-		drVal=$n
-		if [[ $i == 4 ]] 
+		if [[ $jV == $j && $kV == $k && $nV == $n ]]
 		then
-		    drVal=0.8
+		    continue
 		fi
 
-		mixJtDRName=$(echo $drVal | sed -e "s@\.@p@g")
-	    
-		echo "  mixJtDR=$drVal, $mixJtDRName"
+		varName=$(echo "$jV"_"$kV"_DR"$nV" | sed -e "s@/@Over@g" -e "s@\.@p@g")
+		echo "  Variant $varName"
+		selVarNames="$selVarNames$varName,"
+		selVarDPhi="$selVarDPhi$jV,"
+		selVarMultiDPhi="$selVarMultiDPhi$kV,"
+		selVarDR="$selVarDR$nV,"
+	    done
+	done
+    done
+
+    #Variants are written as syst. 'SELVAR<NAME>' in each output and unfolded w/ their own response in gdjHistToUnfold; list them for bash/runUnfold.sh
+    selVarSystFile=logs/$DATE/selVariantSysts_R"$i".txt
+    echo -n "" > $selVarSystFile
+    for varName in ${selVarNames//,/ }
+    do
+	echo "SELVAR${varName^^}" >> $selVarSystFile
+    done
 
-		for p in ${genMinPt[@]}
-		do
+    for p in ${genMinPt[@]}
+    do
 
-		    pos=0
-		    for l in ${ptMins[@]}
-		    do
-			nPtBinsTemp=$nomNPtBins
-			nSubPtBinsTemp=$nomNSubPtBins
+	pos=0
+	for l in ${ptMins[@]}
+	do
+	    nPtBinsTemp=$nomNPtBins
+	    nSubPtBinsTemp=$nomNSubPtBins
 
-			ptBins=$customBinsBase
-			subPtBins=$customSubBinsBase
+	    ptBins=$customBinsBase
+	    subPtBins=$customSubBinsBase
 			
-			startVal=${ptBins#*,}
-			startVal=${ptBins%,$startVal}
+	    startVal=${ptBins#*,}
+	    startVal=${ptBins%,$startVal}
  
-			while [[ $startVal -ne $l ]]
-			do
-			    ptBins=${ptBins#*,}
-			    nPtBinsTemp=$((nPtBinsTemp - 1))
+	    while [[ $startVal -ne $l ]]
+	    do
+		ptBins=${ptBins#*,}
+		nPtBinsTemp=$((nPtBinsTemp - 1))
 
 #			    startVal=${ptBins%,*}
-			    startVal=${ptBins#*,}
-			    startVal=${ptBins%,$startVal}
-			done
-
-			if [[ $startVal -ne $l ]]
-			then
-			    echo "Requested ptMin='$l' not found in custom ptbins array $ptBins. return"
-			    exit 1
-			fi
-
-			startVal=${subPtBins#*,}
-			startVal=${subPtBins%,$startVal}
+		startVal=${ptBins#*,}
+		startVal=${ptBins%,$startVal}
+	    done
+
+	    if [[ $startVal -ne $l ]]
+	    then
+		echo "Requested ptMin='$l' not found in custom ptbins array $ptBins. return"
+		exit 1
+	    fi
+
+	    startVal=${subPtBins#*,}
+	    startVal=${subPtBins%,$startVal}
  
-			while [[ $startVal -ne $l ]]
-			do
-			    subPtBins=${subPtBins#*,}
-			    nSubPtBinsTemp=$((nSubPtBinsTemp - 1))
+	    while [[ $startVal -ne $l ]]
+	    do
+		subPtBins=${subPtBins#*,}
+		nSubPtBinsTemp=$((nSubPtBinsTemp - 1))
 
 #			    startVal=${ptBins%,*}
-			    startVal=${subPtBins#*,}
-			    startVal=${subPtBins%,$startVal}
-			done
-
-			if [[ $startVal -ne $l ]]
-			then
-			    echo "Requested ptMin='$l' not found in custom subPtbins array $subPtBins. return"
-			    exit 1
-			fi
-
-			ptMax=$ptBins		     
-			while [[ $ptMax == *","* ]]
-			do
-			    ptMax=${ptMax#*,}
-			done
-
-			ptMaxReco=${ptBins%,$ptMax}
-			while [[ $ptMaxReco == *","* ]]
-			do
-			    ptMaxReco=${ptMaxReco#*,}
-			done
-
-			ptMinReco=${ptMinsReco[$pos]}
-			ptMinRecoSyst=${ptMinsRecoSyst[$pos]}
-
-
-			echo "   ptMin=$l, ptMax=$ptMax, nPtBins=$nPtBinsTemp, ptBins=$ptBins"
-			pos=$((pos + 1))
+		startVal=${subPtBins#*,}
+		startVal=${subPtBins%,$startVal}
+	    done
+
+	    if [[ $startVal -ne $l ]]
+	    then
+		echo "Requested ptMin='$l' not found in custom subPtbins array $subPtBins. return"
+		exit 1
+	    fi
+
+	    ptMax=$ptBins		     
+	    while [[ $ptMax == *","* ]]
+	    do
+		ptMax=${ptMax#*,}
+	    done
+
+	    ptMaxReco=${ptBins%,$ptMax}
+	    while [[ $ptMaxReco == *","* ]]
+	    do
+		ptMaxReco=${ptMaxReco#*,}
+	    done
+
+	    ptMinReco=${ptMinsReco[$pos]}
+	    ptMinRecoSyst=${ptMinsRecoSyst[$pos]}
+
+
+	    echo "   ptMin=$l, ptMax=$ptMax, nPtBins=$nPtBinsTemp, ptBins=$ptBins"
+	    pos=$((pos + 1))
 #			exit 1
 			
-			for m in ${files[@]}
-			do
-			    newFile=input/ntupleToHist/"$m"_R"$i"_"$dPhiName"_"$multiJtDPhiName"_DR"$mixJtDRName"_GenMin"$p"_"$l".config
-			    logFile=logs/$DATE/"$m"_R"$i"_"$dPhiName"_"$multiJtDPhiName"_DR"$mixJtDRName"_GenMin"$p"_"$l".log
+	    for m in ${files[@]}
+	    do
+		newFile=input/ntupleToHist/"$m"_R"$i"_"$dPhiName"_"$multiJtDPhiName"_DR"$mixJtDRName"_GenMin"$p"_"$l".config
+		logFile=logs/$DATE/"$m"_R"$i"_"$dPhiName"_"$multiJtDPhiName"_DR"$mixJtDRName"_GenMin"$p"_"$l".log
 			    
-			    cp input/ntupleToHist/$m.config $newFile
-			    sed -i "s@INNJTPTBINS@$nPtBinsTemp@g" $newFile
-			    sed -i "s@INNSUBJTPTBINS@$nSubPtBinsTemp@g" $newFile
-			    sed -i "s@INRVAL@$i@g" $newFile
-			    sed -i "s@INGENMINPT@$p@g" $newFile
-			    sed -i "s@INJTPTBINSLOWRECOSYST@$ptMinRecoSyst@g" $newFile
-			    sed -i "s@INJTPTBINSLOWRECO@$ptMinReco@g" $newFile
-			    sed -i "s@INJTPTBINSHIGHRECO@$ptMaxReco@g" $newFile
-			    sed -i "s@INJTPTBINSLOW@$l@g" $newFile
-			    sed -i "s@INJTPTBINSHIGH@$ptMax@g" $newFile
-			    sed -i "s@INJTPTBINSCUSTOM@$ptBins@g" $newFile
-			    sed -i "s@INSUBJTPTBINSCUSTOM@$subPtBins@g" $newFile
-			    sed -i "s@INGAMMAJTDPHINAME@$dPhiName@g" $newFile
-			    sed -i "s@INGAMMAMULTIJTDPHINAME@$multiJtDPhiName@g" $newFile
-			    sed -i "s@INGAMMAJTDPHI@$j@g" $newFile
-			    sed -i "s@INGAMMAMULTIJTDPHI@$k@g" $newFile
-			    sed -i "s@INMIXJETEXCLUSIONDRNAME@$mixJtDRName@g" $newFile
-			    sed -i "s@INMIXJETEXCLUSIONDR@$n@g" $newFile
+		cp input/ntupleToHist/$m.config $newFile
+		sed -i "s@INNJTPTBINS@$nPtBinsTemp@g" $newFile
+		sed -i "s@INNSUBJTPTBINS@$nSubPtBinsTemp@g" $newFile
+		sed -i "s@INRVAL@$i@g" $newFile
+		sed -i "s@INGENMINPT@$p@g" $newFile
+		sed -i "s@INJTPTBINSLOWRECOSYST@$ptMinRecoSyst@g" $newFile
+		sed -i "s@INJTPTBINSLOWRECO@$ptMinReco@g" $newFile
+		sed -i "s@INJTPTBINSHIGHRECO@$ptMaxReco@g" $newFile
+		sed -i "s@INJTPTBINSLOW@$l@g" $newFile
+		sed -i "s@INJTPTBINSHIGH@$ptMax@g" $newFile
+		sed -i "s@INJTPTBINSCUSTOM@$ptBins@g" $newFile
+		sed -i "s@INSUBJTPTBINSCUSTOM@$subPtBins@g" $newFile
+		sed -i "s@INGAMMAJTDPHINAME@$dPhiName@g" $newFile
+		sed -i "s@INGAMMAMULTIJTDPHINAME@$multiJtDPhiName@g" $newFile
+		sed -i "s@INGAMMAJTDPHI@$j@g" $newFile
+		sed -i "s@INGAMMAMULTIJTDPHI@$k@g" $newFile
+		sed -i "s@INMIXJETEXCLUSIONDRNAME@$mixJtDRName@g" $newFile
+		sed -i "s@INMIXJETEXCLUSIONDR@$n@g" $newFile
+
+		if [[ -n $selVarNames ]]
+		then
+		    echo "SELVARIANTNAMES: ${selVarNames%,}" >> $newFile
+		    echo "SELVARIANTGAMMAJTDPHI: ${selVarDPhi%,}" >> $newFile
+		    echo "SELVARIANTGAMMAMULTIJTDPHI: ${selVarMultiDPhi%,}" >> $newFile
+		    echo "SELVARIANTMIXJETEXCLUSIONDR: ${selVarDR%,}" >> $newFile
+		fi
 			
-			    ./bin/gdjNTupleToHist.exe $newFile &> $logFile &
+		./bin/gdjNTupleToHist.exe $newFile &> $logFile &
 #			    exit 1
-			done
-			wait
-		    done
-		done
 	    done
+	    wait
 	done
     done
 done
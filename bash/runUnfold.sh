@@ -1,7 +1,30 @@
 #!/bin/bash
 
-./bin/gdjHistToUnfold.exe input/histToUnfold/histToUnfold_PPMC_R4_XJ.config 
-./bin/gdjHistToUnfold.exe input/histToUnfold/histToUnfold_PPMC_R4_XJJ.config 
+#Optional arg: selection variant syst. list from bash/runAll.sh (logs/<DATE>/selVariantSysts_R<R>.txt), added to each config's UNFOLD list
+selVarSystFile=$1
 
-./bin/gdjHistToUnfold.exe input/histToUnfold/histToUnfold_PbPbMC_R4_XJ.config 
-./bin/gdjHistToUnfold.exe input/histToUnfold/histToUnfold_PbPbMC_R4_XJJ.config 
+configs=(input/histToUnfold/histToUnfold_PPMC_R4_XJ.config input/histToUnfold/histToUnfold_PPMC_R4_XJJ.config input/histToUnfold/histToUnfold_PbPbMC_R4_XJ.config input/histToUnfold/histToUnfold_PbPbMC_R4_XJJ.config)
+
+for c in ${configs[@]}
+do
+    if [[ -n $selVarSystFile ]]
+    then
+	if [[ ! -f $selVarSystFile ]]
+	then
+	    echo "Given selection variant list '$selVarSystFile' not found. return"
+	    exit 1
+	fi
+
+	selVarConfig=${c%.config}_SelVar.config
+	cp $c $selVarConfig
+	#ALL already picks up every syst. in the file
+	if [[ -z $(grep "^UNFOLD: *ALL" $selVarConfig) ]]
+	then
+	    selVarSysts=$(cat $selVarSystFile | tr '\n' ',')
+	    sed -i "s@^UNFOLD: *\(.*\)@UNFOLD: \1,${selVarSysts%,}@g" $selVarConfig
+	fi
+	c=$selVarConfig
+    fi
+
+    ./bin/gdjHistToUnfold.exe $c
+done
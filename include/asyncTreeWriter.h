@@ -0,0 +1,85 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef ASYNCTREEWRITER_H
+#define ASYNCTREEWRITER_H
+
+//c+cpp
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//ROOT
+#include "TTree.h"
+
+//Moves TTree::Fill (basket serialization + compression) off the event loop onto a writer thread
+//The event loop keeps writing its usual branch buffers and calls Fill(); each call snapshots those buffers into a bounded queue,
+//blocking while the queue is full, and the writer restores them into its own buffers + fills the tree
+//Single producer; entries reach the tree in Fill() order, so the tree is entry-identical to filling inline
+class asyncTreeWriter{
+ public:
+  asyncTreeWriter(){};
+  ~asyncTreeWriter();
+
+  //At most in_nQueue entries in flight; in_nQueue == 0 fills the tree in Fill() on the calling thread
+  bool Init(TTree* in_tree_p, unsigned int in_nQueue);
+  //Buffer of in_maxRows rows of in_rowBytes each; w/ in_nRows_p only the first *in_nRows_p rows are copied (variable size arrays)
+  bool AddBranch(std::string in_branchName, void* in_buffer_p, unsigned long long in_rowBytes, int in_maxRows = 1, const int* in_nRows_p = nullptr);
+  //Re-point a branch at another event loop buffer of the same layout, e.g. a per thread copy; not while entries are in flight
+  bool SetEventBuffer(std::string in_branchName, void* in_buffer_p);
+  //in_nZipThreads > 0 turns on ROOT implicit MT so baskets are compressed in parallel at flush
+  bool Start(unsigned int in_nZipThreads = 0);
+
+  void Fill();
+  //Writes out everything queued + joins the writer; the tree is safe to Write() after
+  void Close();
+
+  //Entries handed to Fill(), safe to read from the event loop while the writer runs
+  unsigned long long GetNPushed(){return m_nPushed;}
+  unsigned long long GetNFilled(){return m_nFilled;}
+  unsigned long long GetNWaits(){return m_nWaits;}
+  unsigned long long GetNFillErrors(){return m_nFillErrors;}
+
+ private:
+  struct writerBranch{
+    std::string name;
+    void* eventBuffer_p;
+    unsigned long long rowBytes;
+    int maxRows;
+    const int* nRows_p;
+    //Position in a queue slot and in m_treeBuffer
+    unsigned long long offset;
+  };
+
+  TTree* m_tree_p = nullptr;
+  std::vector<writerBranch> m_branches;
+  unsigned long long m_slotBytes = 0;
+  //Buffers the tree branches point at, only touched by the writer
+  std::vector<char> m_treeBuffer;
+
+  //Ring of m_nQueue slots; bytes copied per slot + branch in m_queueNBytes
+  std::vector<char> m_queue;
+  std::vector<unsigned long long> m_queueNBytes;
+  unsigned int m_nQueue = 0;
+  unsigned int m_head = 0;
+  unsigned int m_tail = 0;
+  unsigned int m_nQueued = 0;
+  bool m_isStarted = false;
+  bool m_isClosing = false;
+  std::mutex m_mutex;
+  std::condition_variable m_notFull, m_notEmpty;
+  std::thread m_writer;
+
+  unsigned long long m_nPushed = 0;
+  unsigned long long m_nFilled = 0;
+  unsigned long long m_nWaits = 0;
+  unsigned long long m_nFillErrors = 0;
+
+  void PushSlot(unsigned int in_slot);
+  void PopSlot(unsigned int in_slot);
+  void WriterLoop();
+};
+
+#endif
@@ -0,0 +1,79 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef BAYESUNFOLDER_H
+#define BAYESUNFOLDER_H
+
+//c+cpp
+#include <string>
+#include <vector>
+
+//ROOT
+#include "TH1.h"
+#include "TH2.h"
+#include "TRandom.h"
+
+//Iterative (D'Agostini) Bayesian unfolding, same algorithm as RooUnfoldBayes
+//One Unfold(N) carries the posterior forward and keeps iterations 1..N, so N iterations cost N steps, not N(N+1)/2
+//Measured-stat errors are propagated incrementally (Adye), one derivative update per iteration
+//Inputs follow RooUnfoldResponse: response x = flattened measured, y = flattened truth, 2-D hists flattened x-fastest, no under/overflow
+//Histograms given to Init are not owned and must outlive the unfolder
+class bayesUnfolder{
+ public:
+  //Matches the UNFOLDERRTYPE config values, i.e. RooUnfold kErrors, kCovToy, kNoError
+  enum errType{ERRORS=0, COVTOY=1, NOERROR=2};
+
+  bayesUnfolder(){};
+  bayesUnfolder(const TH2* in_response_p, const TH1* in_truth_p, const TH1* in_measured_p, const TH1* in_fakes_p = nullptr);
+  ~bayesUnfolder(){};
+
+  bool Init(const TH2* in_response_p, const TH1* in_truth_p, const TH1* in_measured_p, const TH1* in_fakes_p = nullptr);
+  bool Unfold(const TH1* in_data_p, Int_t in_nIter, Int_t in_errType = ERRORS, Int_t in_nToys = 1000);
+
+  void SetRandomGenerator(TRandom* in_randGen_p){m_randGen_p = in_randGen_p; return;}
+
+  Int_t GetNIter(){return m_nIter;}
+  //Iterations are 1..GetNIter(); returned histograms are new and owned by the caller
+  //Unfolded is binned as the truth hist, as RooUnfold::Hreco
+  TH1* GetUnfolded(Int_t in_iter, std::string in_name);
+  //Refolded is response x unfolded, binned as the measured hist with content only, as RooUnfoldResponse::ApplyToTruth
+  TH1* GetRefolded(Int_t in_iter, std::string in_name);
+
+  void Clean();
+
+ private:
+  bool m_isInit = false;
+  const TH1* m_truth_p = nullptr;
+  const TH1* m_measured_p = nullptr;
+  TRandom* m_randGen_p = nullptr;
+
+  Int_t m_nMeas = 0;
+  Int_t m_nTruth = 0;
+  //Causes are the truth bins plus one extra for fakes when the response has any
+  Int_t m_nCause = 0;
+
+  //P(E_j|C_i) at [j*m_nCause + i], efficiency and initial prior per cause
+  std::vector<double> m_pEC;
+  std::vector<double> m_eff;
+  std::vector<double> m_prior;
+  //Normalized response without the fakes cause, for refolding
+  std::vector<double> m_refold;
+
+  Int_t m_nIter = 0;
+  Int_t m_errType = NOERROR;
+  //Per iteration results at [(iter-1)*m_nTruth + i]
+  std::vector<double> m_unfolded;
+  std::vector<double> m_variance;
+
+  //Scratch reused across iterations and toys, freed once Unfold is done
+  std::vector<double> m_p0, m_nbar, m_ujInv, m_mij, m_dndn, m_m3, m_dndnNew;
+
+  void ResizeScratch(bool in_doAlloc);
+  void Iterate(const std::vector<double>* in_nEst, const std::vector<double>* in_nEstVar, std::vector<double>* out_unfolded, std::vector<double>* out_variance);
+
+  static Int_t GetNFlatBins(const TH1* in_hist_p);
+  static Int_t FlatToGlobalBin(const TH1* in_hist_p, Int_t in_flatPos);
+  static std::vector<double> HistToVect(const TH1* in_hist_p, bool in_doErrors = false);
+};
+
+#endif
@@ -0,0 +1,99 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef BINLOOKUP_H
+#define BINLOOKUP_H
+
+//c+cpp
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+//ROOT
+#include "Rtypes.h"
+
+//Sorted-edge binary search, returns pos w/ edges[pos] <= val < edges[pos+1], or (edges[pos], edges[pos+1]] if in_isRightClosed
+//Returns -1 outside of the edges, incl. NaN; EdgeT sets the type edges are compared as
+template <typename T, typename EdgeT = T>
+inline int sortedBinPos(const T* in_edges, unsigned int in_nEdges, double in_val, bool in_isRightClosed = false)
+{
+  if(in_nEdges < 2) return -1;
+
+  const T* end = in_edges + in_nEdges;
+  if(in_isRightClosed){
+    if(!(in_val > (EdgeT)in_edges[0]) || in_val > (EdgeT)in_edges[in_nEdges-1]) return -1;
+    return (int)(std::lower_bound(in_edges, end, in_val, [](const T& edge, double val){return (EdgeT)edge < val;}) - in_edges) - 1;
+  }
+
+  if(!(in_val >= (EdgeT)in_edges[0]) || in_val >= (EdgeT)in_edges[in_nEdges-1]) return -1;
+  return (int)(std::upper_bound(in_edges, end, in_val, [](double val, const T& edge){return val < (EdgeT)edge;}) - in_edges) - 1;
+}
+
+//Bin position from edges, same result as ghostPos(nBins, bins, val) w/ failBounds (edges compared as float, -1 out of range)
+//Uniform binning, e.g. getLinBins, is an O(1) index calc checked against the edges; otherwise binary search
+class binLookup{
+ public:
+  binLookup(){};
+  binLookup(Int_t in_nBins, const Double_t in_bins[]){Init(in_nBins, in_bins);}
+  ~binLookup(){};
+
+  bool Init(Int_t in_nBins, const Double_t in_bins[])
+  {
+    m_edges.clear();
+    m_isUniform = false;
+    m_nBins = 0;
+
+    if(in_nBins < 1){
+      std::cout << "binLookup::Init() error - Given nBins \'" << in_nBins << "\' is less than 1. return false" << std::endl;
+      return false;
+    }
+
+    for(Int_t bI = 0; bI < in_nBins+1; ++bI){
+      m_edges.push_back(in_bins[bI]);
+      if(bI == 0 || m_edges[bI] >= m_edges[bI-1]) continue;
+
+      std::cout << "binLookup::Init() error - Given bins decrease at \'" << bI << "\'. return false" << std::endl;
+      m_edges.clear();
+      return false;
+    }
+    m_nBins = in_nBins;
+
+    //Exactness comes from the edge check in GetBin, tolerance here only decides if the index calc is worth it
+    const double width = ((double)m_edges[m_nBins] - (double)m_edges[0])/(double)m_nBins;
+    m_isUniform = true;
+    for(Int_t bI = 0; bI < m_nBins; ++bI){
+      if(std::abs(((double)m_edges[bI+1] - (double)m_edges[bI])/width - 1.0) < 1.0e-4) continue;
+      m_isUniform = false;
+      break;
+    }
+    m_low = m_edges[0];
+    m_invWidth = 1.0/width;
+
+    return true;
+  }
+
+  int GetBin(double in_val) const
+  {
+    if(!m_isUniform) return sortedBinPos(m_edges.data(), m_edges.size(), in_val);
+    if(!(in_val >= m_edges[0]) || in_val >= m_edges[m_nBins]) return -1;
+
+    int pos = std::min((int)((in_val - m_low)*m_invWidth), m_nBins-1);
+    while(pos > 0 && in_val < m_edges[pos]){--pos;}
+    while(pos < m_nBins-1 && in_val >= m_edges[pos+1]){++pos;}
+    return pos;
+  }
+
+  Int_t GetNBins() const {return m_nBins;}
+  bool IsUniform() const {return m_isUniform;}
+
+ private:
+  //Float as ghostPos stores its edges
+  std::vector<float> m_edges;
+  Int_t m_nBins = 0;
+  bool m_isUniform = false;
+  double m_low = 0.0;
+  double m_invWidth = 0.0;
+};
+
+#endif
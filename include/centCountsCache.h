@@ -0,0 +1,44 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef CENTCOUNTSCACHE_H
+#define CENTCOUNTSCACHE_H
+
+//c+cpp
+#include <map>
+#include <string>
+#include <vector>
+
+//Sidecar of per-input-file centrality counts, as filled by the gdjNtuplePreProc pre-pass for the ncoll weights
+//Keyed by input path, size + mtime, and the same for the centrality table the counts were made with
+//Text file, one line per input: path,size,mtime,tablePath,tableSize,tableMtime,count0,...,count99
+class centCountsCache{
+ public:
+  centCountsCache(){};
+  centCountsCache(std::string inCacheFileName, std::string inTableFileName);
+  ~centCountsCache(){};
+
+  bool Init(std::string inCacheFileName, std::string inTableFileName);
+  bool Get(std::string inFileName, std::vector<double>* outCounts);
+  bool Set(std::string inFileName, const std::vector<double>& inCounts);
+  bool Write();
+
+  unsigned int GetNHits() const {return m_nHits;}
+  unsigned int GetNMisses() const {return m_nMisses;}
+
+  static const unsigned int nCentBins = 100;
+
+ private:
+  std::string GetFileKey(std::string inFileName);
+
+  bool m_isInit = false;
+  bool m_isModified = false;
+  std::string m_cacheFileName;
+  std::string m_tableKey;
+  unsigned int m_nHits = 0;
+  unsigned int m_nMisses = 0;
+  //Key is file key + table key, i.e. all but the counts
+  std::map<std::string, std::vector<double> > m_keyToCounts;
+};
+
+#endif
@@ -25,6 +25,8 @@ class centralityFromInput
   bool m_isInit;
   bool m_isDescending;
   std::vector<double> m_centVals;
+  //m_centVals in ascending order for the binary search in GetCent
+  std::vector<double> m_centValsAscending;
 };
 
 #endif
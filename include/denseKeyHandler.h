@@ -0,0 +1,111 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef DENSEKEYHANDLER_H
+#define DENSEKEYHANDLER_H
+
+//c+cpp
+#include <array>
+#include <iostream>
+#include <string>
+
+//Mixed-radix key over N values, value i in [0, nVals[i]); key = val0 + nVals0*(val1 + nVals1*(val2 + ...))
+//Keys are dense, 0 to GetNKeys()-1, so they can index a flat array (see keyIndexedTable.h)
+//Any value out of range maps to the single key GetOutOfRangeKey(), the last one
+//Fixed arity - a value not binned in is given nVals 1 and is always 0, and is left out of GetKeyStr
+template <unsigned int N>
+class denseKeyHandler{
+ public:
+  denseKeyHandler(){Clean();}
+  denseKeyHandler(std::string in_handlerName){m_handlerName = in_handlerName; Clean();}
+  ~denseKeyHandler(){};
+
+  static constexpr unsigned long long PackKey(const unsigned long long* in_vals, const unsigned long long* in_nVals, unsigned int in_n)
+  {
+    return in_n == 0 ? 0 : in_vals[0] + in_nVals[0]*PackKey(in_vals + 1, in_nVals + 1, in_n - 1);
+  }
+
+  bool Init(const std::array<std::string, N>& in_valNames, const std::array<unsigned long long, N>& in_nVals)
+  {
+    m_valNames = in_valNames;
+    m_nVals = in_nVals;
+    m_outOfRangeKey = 1;
+
+    for(unsigned int vI = 0; vI < N; ++vI){
+      if(m_nVals[vI] == 0){
+	std::cout << "denseKeyHandler::Init() error - Number of values for \'" << m_valNames[vI] << "\' is 0. return false" << std::endl;
+	Clean();
+	return false;
+      }
+      //Test that we will not hit our cap, incl. the out of range key
+      if(m_outOfRangeKey > (__LONG_MAX__ - 1)/m_nVals[vI]){
+	std::cout << "denseKeyHandler::Init() error - Given numbers of values would exceed max key value \'" << __LONG_MAX__ << "\'. return false" << std::endl;
+	Clean();
+	return false;
+      }
+
+      std::cout << "NVals, multiplier for " << m_handlerName << ": " << m_nVals[vI] << ", " << m_outOfRangeKey << std::endl;
+      m_outOfRangeKey *= m_nVals[vI];
+    }
+
+    m_isInit = true;
+    return true;
+  }
+
+  inline unsigned long long GetKey(const std::array<unsigned long long, N>& in_vals) const
+  {
+    for(unsigned int vI = 0; vI < N; ++vI){
+      if(in_vals[vI] >= m_nVals[vI]) return m_outOfRangeKey;
+    }
+
+    return PackKey(in_vals.data(), m_nVals.data(), N);
+  }
+
+  unsigned long long GetNKeys() const {return m_isInit ? m_outOfRangeKey + 1 : 0;}
+  unsigned long long GetOutOfRangeKey() const {return m_outOfRangeKey;}
+
+  std::array<unsigned long long, N> InvertKey(unsigned long long in_key) const
+  {
+    std::array<unsigned long long, N> retVals;
+    for(unsigned int vI = 0; vI < N; ++vI){
+      retVals[vI] = in_key%m_nVals[vI];
+      in_key /= m_nVals[vI];
+    }
+
+    return retVals;
+  }
+
+  std::string GetKeyStr(unsigned long long in_key) const
+  {
+    if(in_key >= m_outOfRangeKey) return "Out of range.";
+
+    std::string retStr = "";
+    std::array<unsigned long long, N> vals = InvertKey(in_key);
+
+    for(unsigned int vI = 0; vI < N; ++vI){
+      if(m_nVals[vI] == 1) continue;
+      retStr = retStr + "Bin \'" + m_valNames[vI] + "\' value=" + std::to_string(vals[vI]) + ",";
+    }
+    if(retStr.size() != 0) retStr.replace(retStr.size()-1, 1, ".");
+
+    return retStr;
+  }
+
+  void Clean()
+  {
+    m_isInit = false;
+    m_outOfRangeKey = 0;
+    m_nVals.fill(1);
+
+    return;
+  }
+
+ private:
+  std::string m_handlerName;
+  bool m_isInit = false;
+  unsigned long long m_outOfRangeKey = 0;
+  std::array<unsigned long long, N> m_nVals;
+  std::array<std::string, N> m_valNames;
+};
+
+#endif
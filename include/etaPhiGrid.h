@@ -0,0 +1,57 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef ETAPHIGRID_H
+#define ETAPHIGRID_H
+
+//c+cpp
+#include <vector>
+
+//Eta-phi binned index of particles for cone sums, e.g. truth photon isolation
+//Cells are at least maxR wide, phi wraps around, eta beyond +-etaMax goes to the edge cells
+//Cone sums match the brute force loop over all particles w/ getDR exactly:
+// same float dR, Et summed in particle order into a float
+class etaPhiGrid{
+ public:
+  etaPhiGrid(){};
+  etaPhiGrid(double in_maxR, double in_etaMax = 5.0);
+  ~etaPhiGrid(){};
+
+  bool Init(double in_maxR, double in_etaMax = 5.0);
+  void Clear();
+  //Returns the index of the particle, i.e. the number added before it
+  int Add(float in_eta, float in_phi, double in_et);
+  void Build();
+
+  //Sum of Et within each of in_radii (dR < R, or dR <= R if in_isInclusive) around eta, phi, skipping particle in_excludeIndex
+  //in_radii must be <= maxR; returns the number of particles in the largest cone
+  unsigned int ConeSums(float in_eta, float in_phi, const std::vector<double>& in_radii, std::vector<float>* out_sums, int in_excludeIndex = -1, bool in_isInclusive = false);
+
+  unsigned int GetNParticles() const {return m_eta.size();}
+
+ private:
+  int GetEtaCell(double in_eta) const;
+  int GetPhiCell(double in_phi) const;
+
+  bool m_isInit = false;
+  bool m_isBuilt = false;
+  double m_maxR = 0.0;
+  double m_etaMax = 0.0;
+  int m_nEtaCells = 0;
+  int m_nPhiCells = 0;
+  double m_etaCellWidth = 0.0;
+  double m_phiCellWidth = 0.0;
+
+  std::vector<float> m_eta;
+  std::vector<float> m_phi;
+  std::vector<double> m_et;
+  std::vector<int> m_cell;
+
+  //Particle indices grouped by cell, cell c is [m_cellStart[c], m_cellStart[c+1])
+  std::vector<unsigned int> m_cellStart;
+  std::vector<unsigned int> m_cellParticles;
+  //Query scratch, kept to avoid allocation per call
+  std::vector<unsigned int> m_candidates;
+};
+
+#endif
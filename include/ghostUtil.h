@@ -5,7 +5,10 @@
 #include <iostream>
 #include <vector>
 
-inline int ghostPos(std::vector<float> bins_, double ghostVal, bool failBounds=true, bool printWarnings=false)
+//Local
+#include "include/binLookup.h"
+
+inline int ghostPos(const std::vector<float>& bins_, double ghostVal, bool failBounds=true, bool printWarnings=false)
 {
   if(bins_.size() == 0){
     std::cout << "MAKECLUSTERTREE GHOSTPOS ERROR: Given bins have size \'0\'. returning int32 max for absurd result" << std::endl;
@@ -21,28 +24,25 @@ inline int ghostPos(std::vector<float> bins_, double ghostVal, bool failBounds=t
     if(!failBounds) ghostPos = bins_.size()-2;//-2 because etabins are 1 greater than rhobins                
     if(printWarnings) std::cout << "WARNING MAKECLUSTERTREE GHOSTPOS: Given value \'" << ghostVal << "\' is above binning (high edge \'" << bins_[bins_.size()-1] << "\'). return pos " << bins_.size()-2 << ", " << bins_[bins_.size()-2] << "-" << bins_[bins_.size()-1] << std::endl;
   }
-  else{
-    for(unsigned int ie = 0; ie < bins_.size()-1; ++ie){
-      if(ghostVal>=bins_.at(ie) && ghostVal<bins_.at(ie+1)){
-        ghostPos = ie;
-        break;
-      }
-    }
-  }
+  else ghostPos = sortedBinPos(bins_.data(), bins_.size(), ghostVal);
   return ghostPos;
 }
 
-inline int ghostPos(Int_t nBins, Double_t bins[], double ghostVal, bool failBounds=true, bool printWarnings=false)
+//Edges compared as float, as when this copied them into a std::vector<float>
+inline int ghostPos(Int_t nBins, const Double_t bins[], double ghostVal, bool failBounds=true, bool printWarnings=false)
 {
-  std::vector<float> binsVect;
-  for(Int_t bI = 0; bI < nBins+1; ++bI){
-    binsVect.push_back(bins[bI]);
+  if(nBins < 1 || printWarnings || ghostVal < (float)bins[0] || ghostVal >= (float)bins[nBins]){
+    std::vector<float> binsVect;
+    for(Int_t bI = 0; bI < nBins+1; ++bI){
+      binsVect.push_back(bins[bI]);
+    }
+    return ghostPos(binsVect, ghostVal, failBounds, printWarnings);
   }
-  return ghostPos(binsVect, ghostVal, failBounds, printWarnings);
+  return sortedBinPos<Double_t, float>(bins, nBins+1, ghostVal);
 }
 
 
-inline int ghostPos(std::vector<int> bins_, double ghostVal, bool failBounds=true, bool printWarnings=false)
+inline int ghostPos(const std::vector<int>& bins_, double ghostVal, bool failBounds=true, bool printWarnings=false)
 {
   if(bins_.size() == 0){
     std::cout << "MAKECLUSTERTREE GHOSTPOS ERROR: Given bins have size \'0\'. returning int32 max for absurd result" << std::endl;
@@ -58,14 +58,7 @@ inline int ghostPos(std::vector<int> bins_, double ghostVal, bool failBounds=tru
     if(!failBounds) ghostPos = bins_.size()-2;//-2 because etabins are 1 greater than rhobins                
     if(printWarnings) std::cout << "WARNING MAKECLUSTERTREE GHOSTPOS: Given value \'" << ghostVal << "\' is above binning (high edge \'" << bins_[bins_.size()-1] << "\'). return pos " << bins_.size()-2 << ", " << bins_[bins_.size()-2] << "-" << bins_[bins_.size()-1] << std::endl;
   }
-  else{
-    for(unsigned int ie = 0; ie < bins_.size()-1; ++ie){
-      if(ghostVal>=bins_.at(ie) && ghostVal<bins_.at(ie+1)){
-        ghostPos = ie;
-        break;
-      }
-    }
-  }
+  else ghostPos = sortedBinPos(bins_.data(), bins_.size(), ghostVal);
   return ghostPos;
 }
 
@@ -0,0 +1,86 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef GRLINDEX_H
+#define GRLINDEX_H
+
+//c+cpp
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+//ROOT
+#include "TMath.h"
+
+//Compiled good run list; per run a bitset of good lumiblocks, all runs in one word array
+//Built from the GRL xml once + cached in binary next to it (<name>.grl.bin), re-parsed when the xml changes
+//Lookups are a run table index + a bit test, no allocation per event
+class grlIndex{
+ public:
+  grlIndex(){};
+  ~grlIndex(){};
+
+  bool Init(std::string in_xmlFileName, bool in_useCache = true);
+
+  unsigned int GetNRuns() const {return m_runs.size();}
+  //Runs in ascending order
+  UInt_t GetRun(unsigned int in_runPos) const {return m_runs[in_runPos];}
+  //-1 if in_run is not in the GRL
+  int GetRunPos(UInt_t in_run) const
+  {
+    if(in_run < m_minRun || in_run - m_minRun >= m_runPosTable.size()) return -1;
+    return m_runPosTable[in_run - m_minRun];
+  }
+  //Position of (run, lumiblock) in the bitset, -1 if not a good lumiblock
+  Long64_t GetBit(UInt_t in_run, UInt_t in_lumiBlock) const
+  {
+    const int runPos = GetRunPos(in_run);
+    if(runPos < 0 || in_lumiBlock >= m_runNLBSpan[runPos]) return -1;
+
+    const ULong64_t bit = m_runBitOffset[runPos] + in_lumiBlock;
+    if(((m_goodWords[bit/64] >> (bit%64)) & 1) == 0) return -1;
+    return bit;
+  }
+  bool IsGood(UInt_t in_run, UInt_t in_lumiBlock) const {return GetBit(in_run, in_lumiBlock) >= 0;}
+
+  unsigned int GetNGoodLB(unsigned int in_runPos) const;
+  //Contiguous good lumiblock ranges [first, last] of a run
+  std::vector<std::pair<UInt_t, UInt_t> > GetLBRanges(unsigned int in_runPos) const;
+
+  //Lumiblocks w/ a selected event, one mask per event loop thread
+  struct firedMask{
+    std::vector<ULong64_t> words;
+    //run << 32 | lumiblock, for fired lumiblocks not in the GRL
+    std::set<ULong64_t> outsideGRL;
+  };
+  void InitFired(firedMask* out_mask_p) const;
+  void SetFired(firedMask* inout_mask_p, UInt_t in_run, UInt_t in_lumiBlock) const
+  {
+    const Long64_t bit = GetBit(in_run, in_lumiBlock);
+    if(bit >= 0) inout_mask_p->words[bit/64] |= (1ULL << (bit%64));
+    else inout_mask_p->outsideGRL.insert((((ULong64_t)in_run) << 32) | in_lumiBlock);
+    return;
+  }
+  void AddFired(firedMask* inout_mask_p, const firedMask& in_mask) const;
+  //Fired lumiblocks of a GRL run, incl. any outside its good ranges
+  unsigned int GetNFiredLB(const firedMask& in_mask, unsigned int in_runPos) const;
+
+ private:
+  std::vector<UInt_t> m_runs;
+  //Lumiblocks covered per run, 0 to max good lumiblock, rounded up to whole words
+  std::vector<UInt_t> m_runNLBSpan;
+  std::vector<ULong64_t> m_runBitOffset;
+  std::vector<ULong64_t> m_goodWords;
+
+  //Dense run -> run position, -1 for runs not in the GRL
+  UInt_t m_minRun = 0;
+  std::vector<int> m_runPosTable;
+
+  bool ParseXML(std::string in_xmlFileName);
+  bool ReadCache(std::string in_cacheFileName, ULong64_t in_xmlSize, Long64_t in_xmlMTime);
+  bool WriteCache(std::string in_cacheFileName, ULong64_t in_xmlSize, Long64_t in_xmlMTime);
+  void BuildRunTable();
+};
+
+#endif
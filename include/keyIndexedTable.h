@@ -0,0 +1,42 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef KEYINDEXEDTABLE_H
+#define KEYINDEXEDTABLE_H
+
+//c+cpp
+#include <vector>
+
+//Flat array w/ one entry per dense key, 0 to nKeys-1 (see denseKeyHandler.h); replaces std::map<key, T> on the per event path
+//Every key has an entry from Init on, so lookups neither allocate nor search
+template <typename T>
+class keyIndexedTable{
+ public:
+  keyIndexedTable(){};
+  keyIndexedTable(unsigned long long in_nKeys, const T& in_initVal = T()){Init(in_nKeys, in_initVal);}
+  ~keyIndexedTable(){};
+
+  void Init(unsigned long long in_nKeys, const T& in_initVal = T()){m_vals.assign(in_nKeys, in_initVal);}
+
+  inline T& operator[](unsigned long long in_key){return m_vals[in_key];}
+  inline const T& operator[](unsigned long long in_key) const {return m_vals[in_key];}
+
+  unsigned long long GetNKeys() const {return m_vals.size();}
+
+  //Per key sum, e.g. merging per thread counters; tables must share nKeys
+  void Add(const keyIndexedTable<T>& in_table)
+  {
+    for(unsigned long long kI = 0; kI < m_vals.size() && kI < in_table.m_vals.size(); ++kI){
+      m_vals[kI] += in_table.m_vals[kI];
+    }
+
+    return;
+  }
+
+  void Clean(){m_vals.clear();}
+
+ private:
+  std::vector<T> m_vals;
+};
+
+#endif
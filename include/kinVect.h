@@ -0,0 +1,128 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef KINVECT_H
+#define KINVECT_H
+
+//c+cpp
+#include <algorithm>
+#include <cmath>
+
+//ROOT
+#include "TLorentzVector.h"
+#include "TMath.h"
+
+//Plain 4-vector for the jet/photon hot loops in place of TLorentzVector
+//Stores pt/eta/phi/m so Pt(), Eta(), Phi() are member reads; px/py are cached on first use for sums
+//No TObject/vtable, trivially copyable, so std::vector<kinVect> copies + sorts are memcpy-cheap
+class kinVect{
+ public:
+  kinVect(){};
+  kinVect(double in_pt, double in_eta, double in_phi, double in_m){SetPtEtaPhiM(in_pt, in_eta, in_phi, in_m);}
+  explicit kinVect(const TLorentzVector& in_tL){SetPxPyPzE(in_tL.Px(), in_tL.Py(), in_tL.Pz(), in_tL.E());}
+
+  void SetPtEtaPhiM(double in_pt, double in_eta, double in_phi, double in_m)
+  {
+    //|pt| + phi in (-pi, pi], as TLorentzVector returns them
+    m_pt = std::abs(in_pt);
+    m_eta = in_eta;
+    m_phi = in_phi;
+    if(m_phi > TMath::Pi() || m_phi <= -TMath::Pi()) m_phi = std::atan2(std::sin(in_phi), std::cos(in_phi));
+    m_m = in_m;
+    m_hasPxPy = false;
+    return;
+  }
+
+  void SetPtEtaPhiE(double in_pt, double in_eta, double in_phi, double in_e)
+  {
+    const double p = std::abs(in_pt)*std::cosh(in_eta);
+    const double m2 = in_e*in_e - p*p;
+    SetPtEtaPhiM(in_pt, in_eta, in_phi, m2 < 0 ? -std::sqrt(-m2) : std::sqrt(m2));
+    return;
+  }
+
+  void SetPxPyPzE(double in_px, double in_py, double in_pz, double in_e)
+  {
+    m_pt = std::sqrt(in_px*in_px + in_py*in_py);
+    m_phi = (in_px == 0.0 && in_py == 0.0) ? 0.0 : std::atan2(in_py, in_px);
+    //TVector3::PseudoRapidity, incl. its +-10e10 along the beam
+    if(m_pt > 0.0) m_eta = std::asinh(in_pz/m_pt);
+    else if(in_pz == 0.0) m_eta = 0.0;
+    else m_eta = in_pz > 0.0 ? 10e10 : -10e10;
+
+    const double m2 = in_e*in_e - (in_px*in_px + in_py*in_py + in_pz*in_pz);
+    m_m = m2 < 0 ? -std::sqrt(-m2) : std::sqrt(m2);
+
+    m_px = in_px;
+    m_py = in_py;
+    m_hasPxPy = true;
+    return;
+  }
+
+  double Pt() const {return m_pt;}
+  double Eta() const {return m_eta;}
+  double Phi() const {return m_phi;}
+  double M() const {return m_m;}
+
+  double Px() const
+  {
+    CachePxPy();
+    return m_px;
+  }
+
+  double Py() const
+  {
+    CachePxPy();
+    return m_py;
+  }
+
+  double Pz() const {return m_pt*std::sinh(m_eta);}
+
+  //As TLorentzVector::SetXYZM
+  double E() const
+  {
+    const double p = m_pt*std::cosh(m_eta);
+    if(m_m >= 0) return std::sqrt(p*p + m_m*m_m);
+    return std::sqrt(std::max(p*p - m_m*m_m, 0.0));
+  }
+
+  kinVect& operator+=(const kinVect& in_kV)
+  {
+    SetPxPyPzE(Px() + in_kV.Px(), Py() + in_kV.Py(), Pz() + in_kV.Pz(), E() + in_kV.E());
+    return *this;
+  }
+
+  kinVect operator+(const kinVect& in_kV) const
+  {
+    kinVect retKV = *this;
+    retKV += in_kV;
+    return retKV;
+  }
+
+  TLorentzVector GetTLorentzVector() const
+  {
+    TLorentzVector retTL;
+    retTL.SetPxPyPzE(Px(), Py(), Pz(), E());
+    return retTL;
+  }
+
+ private:
+  void CachePxPy() const
+  {
+    if(m_hasPxPy) return;
+    m_px = m_pt*std::cos(m_phi);
+    m_py = m_pt*std::sin(m_phi);
+    m_hasPxPy = true;
+    return;
+  }
+
+  double m_pt = 0.0;
+  double m_eta = 0.0;
+  double m_phi = 0.0;
+  double m_m = 0.0;
+  mutable double m_px = 0.0;
+  mutable double m_py = 0.0;
+  mutable bool m_hasPxPy = true;
+};
+
+#endif
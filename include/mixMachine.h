@@ -11,6 +11,9 @@
 #include "TH1D.h"
 #include "TH2D.h"
 
+//Local dependencies
+#include "include/mixMachineStore.h"
+
 class mixMachine{
  public:
   enum mixMode{NONE=0,//Dummy mode - if on things should fail
@@ -18,11 +21,57 @@ class mixMachine{
 	       MULTI=2	  
   };
 
-  mixMachine(){m_isInit = false;};
+  //Histogram slots, resolved to positions in m_hists1D/m_hists2D once at Init
+  enum mixHistType{RAW=0,
+		   MIX=1,
+		   MIXCORRECTION=2,
+		   MIXCORRECTED=3,
+		   SUB=4,
+		   TRUTH=5,
+		   TRUTHWITHRECOMATCH=6,
+		   TRUTHNORECOMATCH=7,
+		   RAWWITHTRUTHMATCH=8,
+		   RAWNOTRUTHMATCH=9,
+		   SINGLETRUTHTOMULTIFAKE=10,
+		   SINGLETRUTHTOMULTIFAKEMIX=11,
+		   NMIXHISTTYPE=12
+  };
+
+  mixMachine(){m_isInit = false; m_store_p = nullptr; m_isSubComputed = false; ResetHistPos();};
   ~mixMachine(){};
 
-  mixMachine(std::string inMixMachineName, mixMachine::mixMode inMixMode, TEnv* inParams_p);
-  bool Init(std::string inMixMachineName, mixMachine::mixMode inMixMode, TEnv* inParams_p);
+  //W/ inStore_p the filled slots live in the store and TH1D/TH2D are only built on request (GetTH*, Write)
+  mixMachine(std::string inMixMachineName, mixMachine::mixMode inMixMode, TEnv* inParams_p, mixMachineStore* inStore_p = nullptr);
+  bool Init(std::string inMixMachineName, mixMachine::mixMode inMixMode, TEnv* inParams_p, mixMachineStore* inStore_p = nullptr);
+  //Typed fills index straight into the hist vectors, no string handling; string versions are wrappers around these
+  bool FillXY(Double_t fillX, Double_t fillY, Double_t fillWeight, mixMachine::mixHistType histType)
+  {
+    const Int_t histPos = m_histPos[histType];
+    if(histPos < 0) return FillError("FillXY", GetMixHistTypeStr(histType));
+
+    if(m_store_p != nullptr){
+      if(m_storePos[histType] < 0) return FillError("FillXY", GetMixHistTypeStr(histType));
+
+      if(m_is2DUnfold) m_store_p->FillXY(m_storePos[histType], fillX, fillY, fillWeight);
+      else m_store_p->FillX(m_storePos[histType], fillX, fillWeight);
+    }
+    else if(m_is2DUnfold) m_hists2D[histPos]->Fill(fillX, fillY, fillWeight);
+    else m_hists1D[histPos]->Fill(fillX, fillWeight);
+    return true;
+  }
+  bool FillX(Double_t fillX, Double_t fillWeight, mixMachine::mixHistType histType)
+  {
+    const Int_t histPos = m_histPos[histType];
+    if(histPos < 0 || m_is2DUnfold) return FillError("FillX", GetMixHistTypeStr(histType));
+
+    if(m_store_p != nullptr){
+      if(m_storePos[histType] < 0) return FillError("FillX", GetMixHistTypeStr(histType));
+      m_store_p->FillX(m_storePos[histType], fillX, fillWeight);
+    }
+    else m_hists1D[histPos]->Fill(fillX, fillWeight);
+    return true;
+  }
+
   bool FillXY(Double_t fillX, Double_t fillY, Double_t fillWeight, std::string mixName);  
   bool FillXYRaw(Double_t fillX, Double_t fillY, Double_t fillWeight);
   bool FillXYMix(Double_t fillX, Double_t fillY, Double_t fillWeight);
@@ -52,17 +101,25 @@ class mixMachine{
   bool GetIsMC(){return m_isMC;}
   bool GetIs2DUnfold(){return m_is2DUnfold;}
   std::string GetMixMachineName(){return m_mixMachineName;}
+  TEnv* GetParams(){return &m_env;}
+  mixMachineStore* GetStore(){return m_store_p;}
 
   TH1D* GetTH1DPtr(std::string histType);
   TH2D* GetTH2DPtr(std::string histType);
+  TH1D* GetTH1DPtr(mixMachine::mixHistType histType);
+  TH2D* GetTH2DPtr(mixMachine::mixHistType histType);
+
+  static std::string GetMixHistTypeStr(mixMachine::mixHistType histType);
+  static mixMachine::mixHistType GetMixHistTypeFromStr(std::string histTypeStr);
 
   Int_t GetNBinsX(){return m_nBinsX;}
   std::vector<double> GetBinsX(){return m_binsXVect;}
   Int_t GetNBinsY(){return m_nBinsY;}
   std::vector<double> GetBinsY(){return m_binsYVect;}
 
-  std::vector<TH1D*> GetTH1D(){return m_hists1D;}
-  std::vector<TH2D*> GetTH2D(){return m_hists2D;}
+  //Store backed machines are moved to plain hists on the vector getters
+  std::vector<TH1D*> GetTH1D(){Unstore(); return m_hists1D;}
+  std::vector<TH2D*> GetTH2D(){Unstore(); return m_hists2D;}
 
   bool Add(mixMachine* machineToAdd, double precision = 0.0001);
   bool Add(mixMachine* machineToAdd1, mixMachine* machineToAdd2, double precision = 0.0001);
@@ -88,6 +145,16 @@ class mixMachine{
 
   std::vector<TH1D*> m_hists1D;
   std::vector<TH2D*> m_hists2D;
+  //-1 for slots not booked, either not in the mix mode or TRUTH slots in data
+  Int_t m_histPos[NMIXHISTTYPE];
+  //Type of each booked hist, same order as m_hists1D/m_hists2D
+  std::vector<mixMachine::mixHistType> m_histTypes;
+
+  //Store slot per type, -1 for unbooked + for the MIXCORRECTED/SUB slots which are only ever derived
+  mixMachineStore* m_store_p;
+  Int_t m_storePos[NMIXHISTTYPE];
+  //Store backed ComputeSub is deferred until MIXCORRECTED/SUB are built
+  bool m_isSubComputed;
   TEnv m_env;
   bool m_is2DUnfold;
   bool m_isMC;
@@ -104,6 +171,19 @@ class mixMachine{
   std::string m_titleX, m_titleY;
 
   std::map<int,bool> m_trackingMap;
+
+  void ResetHistPos();
+  bool FillError(std::string fillFuncName, std::string mixName);
+
+  std::string GetHistName(mixMachine::mixHistType histType);
+  bool IsDerived(mixMachine::mixHistType histType){return histType == MIXCORRECTED || histType == SUB;}
+  TH1* BuildHist(mixMachine::mixHistType histType);
+  TH1* GetHist(mixMachine::mixHistType histType){return m_is2DUnfold ? (TH1*)m_hists2D[m_histPos[histType]] : (TH1*)m_hists1D[m_histPos[histType]];}
+  void SetHist(mixMachine::mixHistType histType, TH1* inHist_p);
+  TH1* Materialize(mixMachine::mixHistType histType);
+  void DeriveHist(mixMachine::mixHistType histType, TH1* inHist_p);
+  void Unstore();
+  void WriteHists();
 };
 
 #endif
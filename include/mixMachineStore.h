@@ -0,0 +1,122 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef MIXMACHINESTORE_H
+#define MIXMACHINESTORE_H
+
+//c+cpp
+#include <algorithm>
+#include <vector>
+
+//ROOT
+#include "TH1.h"
+
+//Dense accumulators for a grid of mixMachines; sumw, sumw2 of every booked hist in one contiguous array each
+//Slots are booked in mixMachine::Init order, i.e. centrality x eta region x syst. x observable x mix type, cells innermost
+//Fills + adds reproduce the TH1D/TH2D arithmetic (bins, sumw2, stats, entries) so CopyToHist gives the hist ROOT would have filled
+class mixMachineStore{
+ public:
+  mixMachineStore(){};
+  ~mixMachineStore(){};
+
+  //Returns the slot; 1-D if in_nBinsY == 0
+  Int_t Book(Int_t in_nBinsX, const Double_t* in_binsX, Int_t in_nBinsY = 0, const Double_t* in_binsY = nullptr);
+
+  //As TH2::Fill(x, y, w) w/ Sumw2
+  void FillXY(Int_t in_slot, Double_t in_x, Double_t in_y, Double_t in_w)
+  {
+    const storeAxes& axes = m_axes[m_slotAxes[in_slot]];
+    Double_t* stats = &(m_stats[in_slot*nStats]);
+    stats[ENTRIES] += 1;
+
+    const Int_t binX = FindBin(axes.nBinsX, &(m_edges[axes.edgesX]), in_x);
+    const Int_t binY = FindBin(axes.nBinsY, &(m_edges[axes.edgesY]), in_y);
+    const ULong64_t cell = m_slotOffset[in_slot] + binY*(axes.nBinsX+2) + binX;
+    m_sumw2[cell] += in_w*in_w;
+    m_sumw[cell] += in_w;
+
+    //Under/overflow does not enter the stats
+    if(binX == 0 || binX > axes.nBinsX) return;
+    if(binY == 0 || binY > axes.nBinsY) return;
+
+    stats[TSUMW] += in_w;
+    stats[TSUMW2] += in_w*in_w;
+    stats[TSUMWX] += in_w*in_x;
+    stats[TSUMWX2] += in_w*in_x*in_x;
+    stats[TSUMWY] += in_w*in_y;
+    stats[TSUMWY2] += in_w*in_y*in_y;
+    stats[TSUMWXY] += in_w*in_x*in_y;
+    return;
+  }
+
+  //As TH1::Fill(x, w) w/ Sumw2
+  void FillX(Int_t in_slot, Double_t in_x, Double_t in_w)
+  {
+    const storeAxes& axes = m_axes[m_slotAxes[in_slot]];
+    Double_t* stats = &(m_stats[in_slot*nStats]);
+    stats[ENTRIES] += 1;
+
+    const Int_t binX = FindBin(axes.nBinsX, &(m_edges[axes.edgesX]), in_x);
+    const ULong64_t cell = m_slotOffset[in_slot] + binX;
+    m_sumw2[cell] += in_w*in_w;
+    m_sumw[cell] += in_w;
+
+    if(binX == 0 || binX > axes.nBinsX) return;
+
+    stats[TSUMW] += in_w;
+    stats[TSUMW2] += in_w*in_w;
+    stats[TSUMWX] += in_w*in_x;
+    stats[TSUMWX2] += in_w*in_x*in_x;
+    return;
+  }
+
+  //As TH1::Add(h, 1.0) of in_store_p slot in_addSlot onto in_slot; binning must match
+  bool Add(Int_t in_slot, mixMachineStore* in_store_p, Int_t in_addSlot);
+  //Bin contents, errors, stats + entries into a hist w/ the booked binning
+  bool CopyToHist(Int_t in_slot, TH1* out_hist_p);
+
+  Int_t GetNSlots(){return m_slotOffset.size();}
+  ULong64_t GetNCells(){return m_sumw.size();}
+  ULong64_t GetNBytes();
+  //Free all accumulators, invalidates every slot
+  void Clear();
+
+ private:
+  enum statPos{TSUMW=0,
+	       TSUMW2=1,
+	       TSUMWX=2,
+	       TSUMWX2=3,
+	       TSUMWY=4,
+	       TSUMWY2=5,
+	       TSUMWXY=6,
+	       ENTRIES=7,
+	       nStats=8
+  };
+
+  //Binning, shared by consecutive slots booked w/ the same edges
+  struct storeAxes{
+    Int_t nBinsX;
+    Int_t nBinsY;
+    ULong64_t edgesX;
+    ULong64_t edgesY;
+  };
+
+  std::vector<Double_t> m_sumw, m_sumw2;
+  std::vector<Double_t> m_stats;
+  std::vector<ULong64_t> m_slotOffset;
+  std::vector<Int_t> m_slotAxes;
+  std::vector<storeAxes> m_axes;
+  std::vector<Double_t> m_edges;
+
+  //As TAxis::FindBin for variable bins: 0 underflow, in_nBins+1 overflow (+ nan)
+  static Int_t FindBin(Int_t in_nBins, const Double_t* in_edges, Double_t in_val)
+  {
+    if(in_val < in_edges[0]) return 0;
+    if(!(in_val < in_edges[in_nBins])) return in_nBins+1;
+    return std::upper_bound(in_edges, in_edges + in_nBins + 1, in_val) - in_edges;
+  }
+
+  bool IsSameAxes(const storeAxes& in_axes, Int_t in_nBinsX, const Double_t* in_binsX, Int_t in_nBinsY, const Double_t* in_binsY);
+};
+
+#endif
@@ -0,0 +1,44 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef MIXSAMPLER_H
+#define MIXSAMPLER_H
+
+//c+cpp
+#include <vector>
+
+//ROOT
+#include "TRandom.h"
+
+//Draws mixed-event positions without replacement in O(K), no rejection loops
+//Random numbers come from a given, non-owned generator, so a fixed seed gives a fixed sequence
+//Scratch arrays are sized to the largest pool seen and restored after each draw, so repeated draws do not allocate
+class mixSampler{
+ public:
+  mixSampler(){};
+  mixSampler(TRandom* in_randGen_p);
+  ~mixSampler(){};
+
+  void SetRandomGenerator(TRandom* in_randGen_p){m_randGen_p = in_randGen_p; return;}
+
+  //K distinct positions from [0, in_nPool), partial Fisher-Yates
+  bool DrawDistinct(unsigned long long in_nPool, unsigned long long in_nDraw, std::vector<unsigned long long>* out_draws);
+  //K pairs with distinct firsts, first != second, and no unordered pair repeated
+  bool DrawPairs(unsigned long long in_nPool, unsigned long long in_nDraw, std::vector<unsigned long long>* out_firsts, std::vector<unsigned long long>* out_seconds);
+
+ private:
+  TRandom* m_randGen_p = nullptr;
+
+  //Identity permutation, swapped during a draw then restored from m_swapLog
+  std::vector<unsigned long long> m_perm;
+  std::vector<unsigned long long> m_swapLog;
+  //For each pool position, linked list of draws whose second is that position
+  std::vector<unsigned long long> m_secondHead;
+  std::vector<unsigned long long> m_secondNext;
+  std::vector<unsigned long long> m_forbidden;
+
+  void Grow(unsigned long long in_nPool);
+  bool DrawSeconds(unsigned long long in_nPool, const std::vector<unsigned long long>* in_firsts, std::vector<unsigned long long>* out_seconds);
+};
+
+#endif
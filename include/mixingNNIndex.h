@@ -0,0 +1,57 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef MIXINGNNINDEX_H
+#define MIXINGNNINDEX_H
+
+//c+cpp
+#include <utility>
+#include <vector>
+
+//k nearest neighbour lookup over the event descriptors of the mixing pool, e.g. (centrality, psi2, vz)
+//Distance is sqrt(sum_d ((x_d - y_d)/scale_d)^2); dimensions w/ scale <= 0 are left out, w/ period > 0 wrap around (psi2, period pi)
+//k-d tree, median split on the widest dimension, built once; queries are const so threads can share one index
+class mixingNNIndex{
+ public:
+  static const unsigned int nMaxDim = 3;
+
+  mixingNNIndex(){};
+  ~mixingNNIndex(){};
+
+  //in_coords point-major, in_nPoints*in_scales.size() values; in_periods same size as in_scales
+  bool Init(const std::vector<double>& in_scales, const std::vector<double>& in_periods, unsigned long long in_nPoints, const std::vector<double>& in_coords);
+  //in_k nearest points to in_point (in_scales.size() coords, unscaled) as (distance, point index), closest first, ties to the lower index
+  void GetNearest(const double* in_point, unsigned int in_k, std::vector<std::pair<double, unsigned long long> >* out_nearest) const;
+  void Clean();
+
+  unsigned long long GetNPoints() const {return m_nPoints;}
+  //Dimensions used in the distance
+  unsigned int GetNDim() const {return m_nDim;}
+
+ private:
+  //Ranges of at most this many points are scanned, not split
+  static const unsigned long long m_leafSize = 8;
+
+  unsigned int m_nInputDim = 0;
+  unsigned int m_nDim = 0;
+  unsigned int m_inputDim[nMaxDim];
+  double m_scales[nMaxDim];
+  //In scaled units, 0 if not periodic
+  double m_periods[nMaxDim];
+
+  unsigned long long m_nPoints = 0;
+  //Scaled coords in tree order, m_nDim per point
+  std::vector<double> m_coords;
+  //Tree order to input point index
+  std::vector<unsigned long long> m_index;
+  //Split dimension of each inner node, at its median position
+  std::vector<unsigned char> m_splitDim;
+
+  void Build(unsigned long long in_low, unsigned long long in_high, const std::vector<double>& in_scaledCoords);
+  void Search(unsigned long long in_low, unsigned long long in_high, const double* in_point, double* in_boxLow, double* in_boxHigh, unsigned int in_k, std::vector<std::pair<double, unsigned long long> >* inout_heap) const;
+  void AddCandidate(unsigned long long in_pos, const double* in_point, unsigned int in_k, std::vector<std::pair<double, unsigned long long> >* inout_heap) const;
+  double GetDist2(unsigned long long in_pos, const double* in_point) const;
+  double GetBoxDist2(const double* in_point, const double* in_boxLow, const double* in_boxHigh) const;
+};
+
+#endif
@@ -0,0 +1,104 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef MIXINGPOOL_H
+#define MIXINGPOOL_H
+
+//c+cpp
+#include <map>
+#include <string>
+#include <vector>
+
+//Non-owning view of the jets of one pooled event; firstJet is the global jet index, e.g. for per-jet side tables
+struct mixingPoolEvent{
+  unsigned long long firstJet;
+  unsigned int nJets;
+  const float* jtPt_p;
+  const float* jtEta_p;
+  const float* jtPhi_p;
+};
+
+//Flat, columnar store of the jets of minimum-bias events used for mixing
+//Events are grouped by keyHandler key; jets kept as contiguous float pt/eta/phi columns (12 bytes per jet)
+//Pool can be written to a binary file and opened again read-only via mmap, so that concurrent jobs share the pages
+//File layout (native endianness):
+// header: magic[8], version, nKeys, nEvents, nJets, configStr size (all unsigned long long)
+// configStr (padded to 8 bytes)
+// keys[nKeys], keyFirstEvent[nKeys+1], eventFirstJet[nEvents+1] (unsigned long long)
+// eventCent[nEvents], eventPsi2[nEvents], eventVz[nEvents] (float, padded to 8 bytes)
+// jtPt[nJets], jtEta[nJets], jtPhi[nJets] (float)
+class mixingPool{
+ public:
+  mixingPool(){};
+  mixingPool(std::string in_poolName);
+  ~mixingPool();
+
+  //Building - call AddEvent for each mixing event and Finalize once before any access
+  void AddEvent(unsigned long long in_key, float in_cent, float in_psi2, float in_vz, const std::vector<float>& in_jtPt, const std::vector<float>& in_jtEta, const std::vector<float>& in_jtPhi);
+  void Finalize();
+
+  bool Write(std::string in_fileName, std::string in_configStr);
+  bool Open(std::string in_fileName);
+  void Clean();
+
+  bool GetIsReady(){return m_isReady;}
+  std::string GetConfigStr(){return m_configStr;}
+  unsigned long long GetNKeys(){return m_nKeys;}
+  unsigned long long GetNEvents(){return m_nEvents;}
+  unsigned long long GetNJets(){return m_nJets;}
+  //Bytes held by the pool, the mapped file size when opened from a file
+  unsigned long long GetNBytes() const;
+  bool GetIsMapped() const {return m_mapAddr_p != nullptr;}
+
+  //Returns false if key has no events; otherwise range of event indices for the key
+  bool GetKeyRange(unsigned long long in_key, unsigned long long* out_firstEvent, unsigned long long* out_nEvents) const;
+  unsigned long long GetKeyByIndex(unsigned long long in_keyIndex) const {return m_keys_p[in_keyIndex];}
+  unsigned long long GetKeyFirstEvent(unsigned long long in_keyIndex) const {return m_keyFirstEvent_p[in_keyIndex];}
+
+  //Non-owning access to the jets of a single event; pointers valid until Clean()
+  unsigned int GetEventJets(unsigned long long in_event, const float** out_jtPt, const float** out_jtEta, const float** out_jtPhi) const;
+  mixingPoolEvent GetEvent(unsigned long long in_event) const;
+  float GetEventCent(unsigned long long in_event) const {return m_eventCent_p[in_event];}
+  float GetEventPsi2(unsigned long long in_event) const {return m_eventPsi2_p[in_event];}
+  float GetEventVz(unsigned long long in_event) const {return m_eventVz_p[in_event];}
+
+ private:
+  std::string m_poolName;
+  std::string m_configStr;
+  bool m_isReady = false;
+
+  //Build side storage, per key
+  struct keyColumns{
+    std::vector<unsigned long long> eventNJets;
+    std::vector<float> eventCent, eventPsi2, eventVz;
+    std::vector<float> jtPt, jtEta, jtPhi;
+  };
+  std::map<unsigned long long, keyColumns> m_buildMap;
+
+  //Flat storage when built in memory
+  std::vector<unsigned long long> m_keys, m_keyFirstEvent, m_eventFirstJet;
+  std::vector<float> m_eventCent, m_eventPsi2, m_eventVz;
+  std::vector<float> m_jtPt, m_jtEta, m_jtPhi;
+
+  //Mapped file when opened
+  void* m_mapAddr_p = nullptr;
+  unsigned long long m_mapSize = 0;
+
+  //Views used for all access, pointing at either of the above
+  unsigned long long m_nKeys = 0;
+  unsigned long long m_nEvents = 0;
+  unsigned long long m_nJets = 0;
+  const unsigned long long* m_keys_p = nullptr;
+  const unsigned long long* m_keyFirstEvent_p = nullptr;
+  const unsigned long long* m_eventFirstJet_p = nullptr;
+  const float* m_eventCent_p = nullptr;
+  const float* m_eventPsi2_p = nullptr;
+  const float* m_eventVz_p = nullptr;
+  const float* m_jtPt_p = nullptr;
+  const float* m_jtEta_p = nullptr;
+  const float* m_jtPhi_p = nullptr;
+
+  unsigned long long GetPadded(unsigned long long inVal);
+};
+
+#endif
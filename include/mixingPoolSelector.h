@@ -0,0 +1,99 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef MIXINGPOOLSELECTOR_H
+#define MIXINGPOOLSELECTOR_H
+
+//c+cpp
+#include <map>
+#include <string>
+#include <vector>
+
+//ROOT
+#include "TRandom.h"
+
+//Picks which mix file entries go into the mixingPool, from the event keys alone so jets are only read for picked entries
+//Per key either the first in_keyCap candidates in entry order or a uniform random sample of in_keyCap
+//A global cap on pooled events lowers the per key cap evenly (water-fill) until the total fits
+//The global cap is applied while candidates come in, so kept records never exceed it by more than one
+//W/ the per key candidate totals of the file (SetKeyTotals/ReadKeyTotals, from an earlier complete pass) the water-fill is done up front
+//and random picks use selection sampling, so both modes know when no key can still gain and the scan can stop
+//Random numbers come from a given, non-owned generator
+class mixingPoolSelector{
+ public:
+  mixingPoolSelector(){};
+  ~mixingPoolSelector(){};
+
+  //in_keys are the possible keys, used to tell when every key is full; in_maxEvents == 0 for no global cap
+  bool Init(unsigned long long in_keyCap, unsigned long long in_maxEvents, const std::vector<unsigned long long>& in_keys, bool in_doReservoir, TRandom* in_randGen_p = nullptr);
+  //One sample of in_maxEvents over all keys, no per key cap - for draws that ignore the key (MIXNN); candidates keep their key
+  bool InitGlobal(unsigned long long in_maxEvents, bool in_doReservoir, TRandom* in_randGen_p = nullptr);
+
+  //Number of candidates per key over the whole file, w/ the same cuts as the AddCandidate calls; keys not given have none
+  //For InitGlobal the totals are summed
+  //Call after Init, before any AddCandidate
+  void SetKeyTotals(const std::map<unsigned long long, unsigned long long>& in_keyTotals);
+  //Text file, first line in_configStr then one 'key total' per line; false if missing or written w/ a different config
+  bool ReadKeyTotals(std::string in_fileName, std::string in_configStr);
+  //Candidates seen per key, after Finalize; only valid as totals if every entry of the file was offered. Not for InitGlobal
+  bool WriteKeyTotals(std::string in_fileName, std::string in_configStr) const;
+  bool GetHasKeyTotals() const {return m_hasKeyTotals;}
+
+  struct candidate{
+    unsigned long long entry;
+    unsigned long long key;
+    //As computed in the key pass, so pool diagnostics see the same values as before
+    double cent;
+    float psi2;
+    double vz;
+  };
+  void AddCandidate(unsigned long long in_key, unsigned long long in_entry, double in_cent, float in_psi2, double in_vz);
+  //Once true no later entry can enter the pool - every key is at its cap or, w/ key totals, has no candidates left
+  //W/o key totals this only happens for first-N, a reservoir key can always swap
+  bool GetIsSaturated() const {return m_nKeys > 0 && m_nDoneKeys >= m_nKeys;}
+
+  //Applies the global cap; selected candidates sorted by entry
+  void Finalize();
+  unsigned long long GetNCandidates() const {return m_nCandidates;}
+  unsigned long long GetNSelected() const {return m_selected.size();}
+  unsigned long long GetKeyCap() const {return m_keyCap;}
+  //Most candidate records held at once during the scan
+  unsigned long long GetNKeptMax() const {return m_nKeptMax;}
+  const candidate& GetSelected(unsigned long long in_selI) const {return m_selected[in_selI];}
+  void Clean();
+
+ private:
+  unsigned long long m_keyCap = 0;
+  unsigned long long m_maxEvents = 0;
+  unsigned long long m_nKeys = 0;
+  bool m_doReservoir = false;
+  bool m_hasKeyTotals = false;
+  bool m_isGlobal = false;
+  TRandom* m_randGen_p = nullptr;
+
+  struct keySample{
+    bool isExpected = false;
+    bool isDone = false;
+    unsigned long long nSeen = 0;
+    unsigned long long nTotal = 0;
+    std::vector<candidate> kept;
+  };
+  std::map<unsigned long long, keySample> m_keySamples;
+  unsigned long long m_nDoneKeys = 0;
+  unsigned long long m_nCandidates = 0;
+  unsigned long long m_nKept = 0;
+  unsigned long long m_nKeptMax = 0;
+
+  std::vector<candidate> m_selected;
+  std::map<unsigned long long, unsigned long long> m_keyNSeen;
+
+  //Largest per key cap <= m_keyCap w/ the summed min(count, cap) under m_maxEvents; counts are the kept sizes or the key totals
+  unsigned long long GetWaterFillCap(bool in_useTotals) const;
+  //Drops kept records over in_keyCap, a uniform subset for reservoir and the first in entry order otherwise
+  void TrimKept(std::vector<candidate>* inout_kept, unsigned long long in_keyCap);
+  void SetDone(keySample* inout_sample);
+  //Uniform in [0, in_n)
+  unsigned long long GetRandomPos(unsigned long long in_n);
+};
+
+#endif
@@ -0,0 +1,195 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef PHOJETSEL_H
+#define PHOJETSEL_H
+
+//c+cpp
+#include <cmath>
+#include <limits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+//ROOT
+#include "TMath.h"
+
+//Local
+#include "include/etaPhiFunc.h"
+
+//Photon-jet selection over whole jet arrays, one photon at a time
+//With SSE2 (any x86-64) jets go 4 at a time, the remainder and other targets take the branch-free scalar loop
+//Values are bit-identical to TMath::Abs(getDPHI(jetPhi, phoPhi)) and getDR(jetEta, jetPhi, phoEta, phoPhi),
+//which getPhoJetSelScalar uses directly - it is the reference, see testPhoJetSel
+
+//Bits of the per jet pass mask
+const unsigned char PHOJETSEL_PT = 1;
+const unsigned char PHOJETSEL_ETA = 2;
+const unsigned char PHOJETSEL_DR = 4;
+const unsigned char PHOJETSEL_DPHI = 8;
+const unsigned char PHOJETSEL_ALL = PHOJETSEL_PT | PHOJETSEL_ETA | PHOJETSEL_DR | PHOJETSEL_DPHI;
+
+//ptLow <= pt < ptHigh, etaLow <= eta <= etaHigh, dR >= exclusionDR, |dphi| >= dPhiLow; defaults pass every jet
+//Cuts are double, as in the configs, and compare to the float jet values as in a plain (float >= double)
+struct phoJetSelCuts{
+  Double_t ptLow = std::numeric_limits<Double_t>::lowest();
+  Double_t ptHigh = std::numeric_limits<Double_t>::max();
+  Double_t etaLow = std::numeric_limits<Double_t>::lowest();
+  Double_t etaHigh = std::numeric_limits<Double_t>::max();
+  Double_t exclusionDR = 0.0;
+  Double_t dPhiLow = 0.0;
+};
+
+//Smallest float >= in_cut, so for float x (x >= in_cut) is (x >= getFloatAtOrAbove(in_cut)), likewise for <
+inline Float_t getFloatAtOrAbove(Double_t in_cut)
+{
+  Float_t cut = (Float_t)in_cut;
+  if((Double_t)cut < in_cut) cut = std::nextafter(cut, std::numeric_limits<Float_t>::infinity());
+  return cut;
+}
+
+//Largest float <= in_cut, so for float x (x <= in_cut) is (x <= getFloatAtOrBelow(in_cut))
+inline Float_t getFloatAtOrBelow(Double_t in_cut)
+{
+  Float_t cut = (Float_t)in_cut;
+  if((Double_t)cut > in_cut) cut = std::nextafter(cut, -std::numeric_limits<Float_t>::infinity());
+  return cut;
+}
+
+//getDPHI w/o the out of range printout, same float/double conversions so same result; the scalar tail of the kernels
+inline Float_t getAbsDPHINoPrint(Float_t phi1, Float_t phi2)
+{
+  Float_t dphi = phi1 - phi2;
+  dphi = ((Double_t)dphi > TMath::Pi()) ? (Float_t)((Double_t)dphi - 2.*TMath::Pi()) : dphi;
+  dphi = ((Double_t)dphi <= -TMath::Pi()) ? (Float_t)((Double_t)dphi + 2.*TMath::Pi()) : dphi;
+  return std::fabs(dphi);
+}
+
+#if defined(__SSE2__)
+//4 jets of getAbsDPHINoPrint + getDR; the wrap tests are done in float - (float)Pi() > Pi(), so for float dphi
+//(Double_t)dphi > Pi() is dphi >= (float)Pi() and (Double_t)dphi <= -Pi() is dphi <= -(float)Pi()
+inline void getPhoJetDRDPhiSSE(const Float_t* in_eta, const Float_t* in_phi, __m128 in_phoEta, __m128 in_phoPhi, __m128* out_dR, __m128* out_dPhi)
+{
+  const __m128 piF = _mm_set1_ps((Float_t)TMath::Pi());
+  const __m128 minusPiF = _mm_set1_ps(-(Float_t)TMath::Pi());
+  const __m128d twoPi = _mm_set1_pd(2.*TMath::Pi());
+  const __m128 absMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+
+  __m128 dphi = _mm_sub_ps(_mm_loadu_ps(in_phi), in_phoPhi);
+
+  __m128 isOver = _mm_cmpge_ps(dphi, piF);
+  __m128 dphiDown = _mm_movelh_ps(_mm_cvtpd_ps(_mm_sub_pd(_mm_cvtps_pd(dphi), twoPi)), _mm_cvtpd_ps(_mm_sub_pd(_mm_cvtps_pd(_mm_movehl_ps(dphi, dphi)), twoPi)));
+  dphi = _mm_or_ps(_mm_and_ps(isOver, dphiDown), _mm_andnot_ps(isOver, dphi));
+
+  __m128 isUnder = _mm_cmple_ps(dphi, minusPiF);
+  __m128 dphiUp = _mm_movelh_ps(_mm_cvtpd_ps(_mm_add_pd(_mm_cvtps_pd(dphi), twoPi)), _mm_cvtpd_ps(_mm_add_pd(_mm_cvtps_pd(_mm_movehl_ps(dphi, dphi)), twoPi)));
+  dphi = _mm_or_ps(_mm_and_ps(isUnder, dphiUp), _mm_andnot_ps(isUnder, dphi));
+
+  __m128 deta = _mm_sub_ps(_mm_loadu_ps(in_eta), in_phoEta);
+  *out_dPhi = _mm_and_ps(dphi, absMask);
+  *out_dR = _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(dphi, dphi), _mm_mul_ps(deta, deta)));
+  return;
+}
+#endif
+
+//dR and |dphi| of in_nJets jets to the photon
+inline void getPhoJetDRDPhi(unsigned int in_nJets, const Float_t* in_eta, const Float_t* in_phi, Float_t in_phoEta, Float_t in_phoPhi, Float_t* out_dR, Float_t* out_dPhi)
+{
+  unsigned int jI = 0;
+#if defined(__SSE2__)
+  const __m128 phoEta = _mm_set1_ps(in_phoEta);
+  const __m128 phoPhi = _mm_set1_ps(in_phoPhi);
+  for(; jI + 4 <= in_nJets; jI += 4){
+    __m128 dR, dPhi;
+    getPhoJetDRDPhiSSE(in_eta + jI, in_phi + jI, phoEta, phoPhi, &dR, &dPhi);
+    _mm_storeu_ps(out_dR + jI, dR);
+    _mm_storeu_ps(out_dPhi + jI, dPhi);
+  }
+#endif
+
+  for(; jI < in_nJets; ++jI){
+    const Float_t dphi = getAbsDPHINoPrint(in_phi[jI], in_phoPhi);
+    const Float_t deta = in_eta[jI] - in_phoEta;
+    out_dPhi[jI] = dphi;
+    out_dR[jI] = std::sqrt(dphi*dphi + deta*deta);
+  }
+
+  return;
+}
+
+//As getPhoJetDRDPhi, plus the PHOJETSEL_* pass mask of in_cuts, in one pass
+inline void getPhoJetSel(unsigned int in_nJets, const Float_t* in_pt, const Float_t* in_eta, const Float_t* in_phi, Float_t in_phoEta, Float_t in_phoPhi, const phoJetSelCuts& in_cuts, Float_t* out_dR, Float_t* out_dPhi, unsigned char* out_mask)
+{
+  //Float thresholds, same pass/fail as the double cuts
+  const Float_t ptLowF = getFloatAtOrAbove(in_cuts.ptLow);
+  const Float_t ptHighF = getFloatAtOrAbove(in_cuts.ptHigh);
+  const Float_t etaLowF = getFloatAtOrAbove(in_cuts.etaLow);
+  const Float_t etaHighF = getFloatAtOrBelow(in_cuts.etaHigh);
+  const Float_t exclusionDRF = getFloatAtOrAbove(in_cuts.exclusionDR);
+  const Float_t dPhiLowF = getFloatAtOrAbove(in_cuts.dPhiLow);
+
+  unsigned int jI = 0;
+#if defined(__SSE2__)
+  const __m128 phoEta = _mm_set1_ps(in_phoEta);
+  const __m128 phoPhi = _mm_set1_ps(in_phoPhi);
+  const __m128 ptLow = _mm_set1_ps(ptLowF);
+  const __m128 ptHigh = _mm_set1_ps(ptHighF);
+  const __m128 etaLow = _mm_set1_ps(etaLowF);
+  const __m128 etaHigh = _mm_set1_ps(etaHighF);
+  const __m128 exclusionDR = _mm_set1_ps(exclusionDRF);
+  const __m128 dPhiLow = _mm_set1_ps(dPhiLowF);
+  for(; jI + 4 <= in_nJets; jI += 4){
+    __m128 dR, dPhi;
+    getPhoJetDRDPhiSSE(in_eta + jI, in_phi + jI, phoEta, phoPhi, &dR, &dPhi);
+    _mm_storeu_ps(out_dR + jI, dR);
+    _mm_storeu_ps(out_dPhi + jI, dPhi);
+
+    const __m128 pt = _mm_loadu_ps(in_pt + jI);
+    const __m128 eta = _mm_loadu_ps(in_eta + jI);
+    //One bit per jet for each cut
+    const int passPt = _mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(pt, ptLow), _mm_cmplt_ps(pt, ptHigh)));
+    const int passEta = _mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(eta, etaLow), _mm_cmple_ps(eta, etaHigh)));
+    const int passDR = _mm_movemask_ps(_mm_cmpge_ps(dR, exclusionDR));
+    const int passDPhi = _mm_movemask_ps(_mm_cmpge_ps(dPhi, dPhiLow));
+    for(unsigned int vI = 0; vI < 4; ++vI){
+      out_mask[jI + vI] = (((passPt >> vI) & 1)*PHOJETSEL_PT) | (((passEta >> vI) & 1)*PHOJETSEL_ETA) | (((passDR >> vI) & 1)*PHOJETSEL_DR) | (((passDPhi >> vI) & 1)*PHOJETSEL_DPHI);
+    }
+  }
+#endif
+
+  for(; jI < in_nJets; ++jI){
+    const Float_t dphi = getAbsDPHINoPrint(in_phi[jI], in_phoPhi);
+    const Float_t deta = in_eta[jI] - in_phoEta;
+    const Float_t dR = std::sqrt(dphi*dphi + deta*deta);
+    out_dPhi[jI] = dphi;
+    out_dR[jI] = dR;
+
+    unsigned char mask = (in_pt[jI] >= ptLowF && in_pt[jI] < ptHighF) ? PHOJETSEL_PT : 0;
+    mask |= (in_eta[jI] >= etaLowF && in_eta[jI] <= etaHighF) ? PHOJETSEL_ETA : 0;
+    mask |= (dR >= exclusionDRF) ? PHOJETSEL_DR : 0;
+    mask |= (dphi >= dPhiLowF) ? PHOJETSEL_DPHI : 0;
+    out_mask[jI] = mask;
+  }
+
+  return;
+}
+
+//Reference, jet by jet w/ getDR + getDPHI
+inline void getPhoJetSelScalar(unsigned int in_nJets, const Float_t* in_pt, const Float_t* in_eta, const Float_t* in_phi, Float_t in_phoEta, Float_t in_phoPhi, const phoJetSelCuts& in_cuts, Float_t* out_dR, Float_t* out_dPhi, unsigned char* out_mask)
+{
+  for(unsigned int jI = 0; jI < in_nJets; ++jI){
+    out_dR[jI] = getDR(in_eta[jI], in_phi[jI], in_phoEta, in_phoPhi);
+    out_dPhi[jI] = TMath::Abs(getDPHI(in_phi[jI], in_phoPhi));
+
+    out_mask[jI] = 0;
+    if(in_pt[jI] >= in_cuts.ptLow && in_pt[jI] < in_cuts.ptHigh) out_mask[jI] |= PHOJETSEL_PT;
+    if(in_eta[jI] >= in_cuts.etaLow && in_eta[jI] <= in_cuts.etaHigh) out_mask[jI] |= PHOJETSEL_ETA;
+    if(out_dR[jI] >= in_cuts.exclusionDR) out_mask[jI] |= PHOJETSEL_DR;
+    if(out_dPhi[jI] >= in_cuts.dPhiLow) out_mask[jI] |= PHOJETSEL_DPHI;
+  }
+
+  return;
+}
+
+#endif
@@ -0,0 +1,25 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef RANDUTIL_H
+#define RANDUTIL_H
+
+//Per event generator seed from a job seed, file index and entry
+//Reseeding per event makes draws independent of which thread/shard processes the event, so output does not depend on NTHREADS
+//splitmix64 finalizer over the packed inputs; never 0, which TRandom3::SetSeed would replace w/ a time based seed
+inline unsigned int getEventSeed(unsigned long long in_baseSeed, unsigned long long in_fileI, unsigned long long in_entry)
+{
+  unsigned long long seed = in_baseSeed;
+  const unsigned long long vals[2] = {in_fileI, in_entry};
+  for(unsigned int vI = 0; vI < 2; ++vI){
+    seed ^= vals[vI] + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2);
+    seed = (seed ^ (seed >> 30))*0xbf58476d1ce4e5b9ULL;
+    seed = (seed ^ (seed >> 27))*0x94d049bb133111ebULL;
+    seed ^= seed >> 31;
+  }
+
+  const unsigned int retSeed = (unsigned int)(seed ^ (seed >> 32));
+  return retSeed == 0 ? 1 : retSeed;
+}
+
+#endif
@@ -0,0 +1,81 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef RECOJETTABLE_H
+#define RECOJETTABLE_H
+
+//c+cpp
+#include <vector>
+
+//Local
+#include "include/kinVect.h"
+
+//Per event reco jet columns, filled once and shared by every syst./selection variation of gdjNTupleToHist
+//Variations only differ in their cuts (jet pt minimum, photon-jet dphi, ...), so photon-jet and jet-jet kinematics
+//are computed on first use and cached for the event; each variation then re-evaluates only its own selection
+class recoJetTable{
+ public:
+  recoJetTable(){};
+  ~recoJetTable(){};
+
+  //Start a new event w/ in_nPhotons reco photons; cached kinematics are invalidated w/o clearing the caches
+  void Clear(unsigned int in_nPhotons);
+  //Returns the jet index in the table
+  unsigned int AddJet(float in_pt, float in_eta, float in_phi, int in_truthPos, bool in_isInAcceptance);
+
+  unsigned int GetNJets() const {return m_pt.size();}
+  float GetPt(unsigned int in_jetI) const {return m_pt[in_jetI];}
+  float GetEta(unsigned int in_jetI) const {return m_eta[in_jetI];}
+  float GetPhi(unsigned int in_jetI) const {return m_phi[in_jetI];}
+  int GetTruthPos(unsigned int in_jetI) const {return m_truthPos[in_jetI];}
+  const kinVect& GetJet(unsigned int in_jetI) const {return m_jet[in_jetI];}
+  //Reco pt/eta acceptance excl. the lower pt cut, which is per variation
+  bool GetIsInAcceptance(unsigned int in_jetI) const {return m_isInAcceptance[in_jetI];}
+
+  //Variation selection, jets in acceptance w/ pt >= in_ptLow, in table order
+  void GetJetsAbovePt(float in_ptLow, std::vector<unsigned int>* out_jets) const;
+
+  //|dphi| and dR between jet and photon, as TMath::Abs(getDPHI(jetPhi, phoPhi)) and getDR(jetEta, jetPhi, phoEta, phoPhi)
+  //The photon's values for every jet are computed together on its first lookup in the event (getPhoJetDRDPhi)
+  void GetPhoJetDPhiDR(unsigned int in_phoI, float in_phoEta, float in_phoPhi, unsigned int in_jetI, float* out_dPhi, float* out_dR);
+
+  //Jet pair kinematics, photon independent; in_jetI before in_jetI2 in table order
+  struct jetPair{
+    float dPhiJJ;
+    float dRJJ;
+    //4-vector sum jet2 + jet1
+    double sumPt;
+    double sumPhi;
+  };
+  const jetPair& GetJetPair(unsigned int in_jetI, unsigned int in_jetI2);
+
+  unsigned long long GetNPairsComputed() const {return m_nPairsComputed;}
+  unsigned long long GetNPairsRequested() const {return m_nPairsRequested;}
+
+ private:
+  unsigned int m_nPhotons = 0;
+  //Bumped per event, cache entries are valid if their stamp matches
+  unsigned int m_stamp = 0;
+
+  std::vector<float> m_pt, m_eta, m_phi;
+  std::vector<int> m_truthPos;
+  std::vector<bool> m_isInAcceptance;
+  std::vector<kinVect> m_jet;
+
+  //Photon-jet cache, [phoI*nJets + jetI]; sized at first use in the event
+  std::vector<unsigned int> m_phoJetStamp;
+  std::vector<float> m_phoJetDPhi, m_phoJetDR;
+  unsigned int m_phoJetNJets = 0;
+
+  //Jet pair cache, [jetI*nJets + jetI2]
+  std::vector<unsigned int> m_pairStamp;
+  std::vector<jetPair> m_pairs;
+  unsigned int m_pairNJets = 0;
+
+  unsigned long long m_nPairsComputed = 0;
+  unsigned long long m_nPairsRequested = 0;
+
+  void ResizeCaches();
+};
+
+#endif
@@ -0,0 +1,82 @@
+//Author: Chris McGinn (2026.10.17)
+//Contact at chmc7718@colorado.edu or cffionn on skype for bugs
+
+#ifndef THREADUTIL_H
+#define THREADUTIL_H
+
+//c+cpp
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <utility>
+#include <vector>
+
+//Local
+#include "include/mixMachine.h"
+#include "include/mixMachineStore.h"
+
+//Event loop threading as done in gdjNTupleToHist, shared w/ the tests so they run the same split, shards + merge
+
+//Contiguous [start, end) entry ranges for in_nEntries entries from in_entryStart over in_nThreads, last thread picks up the remainder
+inline std::vector<std::pair<ULong64_t, ULong64_t> > getThreadEntryRanges(ULong64_t in_entryStart, ULong64_t in_nEntries, Int_t in_nThreads)
+{
+  std::vector<std::pair<ULong64_t, ULong64_t> > ranges;
+  const ULong64_t nEntriesPerThread = in_nEntries/in_nThreads;
+  for(Int_t wI = 0; wI < in_nThreads; ++wI){
+    const ULong64_t threadStart = in_entryStart + wI*nEntriesPerThread;
+    ULong64_t threadEnd = threadStart + nEntriesPerThread;
+    if(wI == in_nThreads-1) threadEnd = in_entryStart + in_nEntries;
+    ranges.push_back({threadStart, threadEnd});
+  }
+  return ranges;
+}
+
+//Calls in_processEntryRange(workerI, start, end) for each range, one std::thread per range (in place for a single range)
+//Returns the first worker w/ a non-zero return, -1 if all succeeded
+inline Int_t runThreadEntryRanges(const std::vector<std::pair<ULong64_t, ULong64_t> >& in_ranges, const std::function<int(Int_t, ULong64_t, ULong64_t)>& in_processEntryRange)
+{
+  if(in_ranges.size() == 1) return in_processEntryRange(0, in_ranges[0].first, in_ranges[0].second) == 0 ? -1 : 0;
+
+  std::vector<int> workerReturns(in_ranges.size(), 0);
+  std::vector<std::thread> workers;
+  for(unsigned int wI = 0; wI < in_ranges.size(); ++wI){
+    workers.push_back(std::thread([&, wI](){workerReturns[wI] = in_processEntryRange(wI, in_ranges[wI].first, in_ranges[wI].second);}));
+  }
+
+  for(unsigned int wI = 0; wI < workers.size(); ++wI){
+    workers[wI].join();
+  }
+
+  for(unsigned int wI = 0; wI < workerReturns.size(); ++wI){
+    if(workerReturns[wI] != 0) return wI;
+  }
+  return -1;
+}
+
+//Per thread copy of a mixMachine, booked in the thread's own store; thread 0 (in_doClone false) fills the original in place
+inline mixMachine* getShardMixMachine(mixMachine* in_mixMachine_p, bool in_doClone, mixMachineStore* in_store_p)
+{
+  if(!in_doClone) return in_mixMachine_p;
+  return new mixMachine(in_mixMachine_p->GetMixMachineName(), in_mixMachine_p->GetMixMode(), in_mixMachine_p->GetParams(), in_store_p);
+}
+
+//Adds each thread copy onto its original w/ mixMachine::Add, then cleans + deletes the copy
+inline bool mergeShardMixMachines(const std::vector<mixMachine*>& in_originals, const std::vector<mixMachine*>& in_shards)
+{
+  if(in_originals.size() != in_shards.size()){
+    std::cout << "mergeShardMixMachines error - " << in_originals.size() << " originals vs. " << in_shards.size() << " thread copies. return false" << std::endl;
+    return false;
+  }
+
+  for(unsigned int mI = 0; mI < in_originals.size(); ++mI){
+    if(!in_originals[mI]->Add(in_shards[mI])){
+      std::cout << "mergeShardMixMachines error - Failed to merge mixMachine \'" << in_shards[mI]->GetMixMachineName() << "\'. return false" << std::endl;
+      return false;
+    }
+    in_shards[mI]->Clean();
+    delete in_shards[mI];
+  }
+  return true;
+}
+
+#endif
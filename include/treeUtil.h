@@ -7,9 +7,15 @@
 #include <vector>
 
 //ROOT
+#include "TDirectory.h"
 #include "TObjArray.h"
+#include "TRegexp.h"
+#include "TString.h"
 #include "TTree.h"
 
+//Local
+#include "include/stringUtil.h"
+
 inline std::vector<std::string> getVectBranchList(TTree* inTree_p)
 {
   std::vector<std::string> branchList;
@@ -21,4 +27,165 @@ inline std::vector<std::string> getVectBranchList(TTree* inTree_p)
   return branchList;
 }
 
+//Name to TFile::SetCompressionSettings value, 100*algorithm + level; -1 if not valid
+inline int getCompressionSettings(std::string inAlgo, int inLevel)
+{
+  inAlgo = returnAllCapsString(inAlgo);
+
+  int algo = -1;
+  if(isStrSame(inAlgo, "ZLIB")) algo = 1;
+  else if(isStrSame(inAlgo, "LZMA")) algo = 2;
+  else if(isStrSame(inAlgo, "LZ4")) algo = 4;
+  else if(isStrSame(inAlgo, "ZSTD")) algo = 5;
+
+  if(algo < 0 || inLevel < 0 || inLevel > 9){
+    std::cout << "getCompressionSettings error - Given algorithm '" << inAlgo << "', level " << inLevel << " is not valid (ZLIB, LZMA, LZ4, ZSTD w/ level 0-9). return -1" << std::endl;
+    return -1;
+  }
+
+  return 100*algo + inLevel;
+}
+
+//Empty clone of inTree_p keeping only inBranches (wildcards like HLT_* allowed)
+//Clone shares the branch addresses of inTree_p, so fill it in place of inTree_p
+//Names matching no branch (e.g. cent in pp) are skipped w/ a warning; returns nullptr if nothing matched
+inline TTree* makeSlimTree(TTree* inTree_p, std::vector<std::string> inBranches, Int_t inBasketSize = -1, Long64_t inAutoFlush = 0)
+{
+  std::vector<std::string> branchList = getVectBranchList(inTree_p);
+
+  inTree_p->SetBranchStatus("*", 0);
+  unsigned int nKept = 0;
+  for(auto const & branch : inBranches){
+    TRegexp branchRegexp(branch.c_str(), kTRUE);
+    bool isFound = false;
+
+    for(auto const & branchName : branchList){
+      TString branchNameT = branchName.c_str();
+      if(branchNameT.Index(branchRegexp) == kNPOS) continue;
+
+      inTree_p->SetBranchStatus(branchName.c_str(), 1);
+      isFound = true;
+      ++nKept;
+    }
+
+    if(!isFound) std::cout << "makeSlimTree warning - Slim branch '" << branch << "' matches no branch in tree '" << inTree_p->GetName() << "', skipping" << std::endl;
+  }
+
+  TTree* slimTree_p = nullptr;
+  if(nKept == 0) std::cout << "makeSlimTree error - No slim branches found in tree '" << inTree_p->GetName() << "'. return nullptr" << std::endl;
+  else{
+    //CloneTree attaches the clone to gDirectory, so make sure that is the file of inTree_p
+    TDirectory* prevDir_p = gDirectory;
+    if(inTree_p->GetDirectory() != nullptr) inTree_p->GetDirectory()->cd();
+    slimTree_p = inTree_p->CloneTree(0);
+    prevDir_p->cd();
+    if(inBasketSize > 0) slimTree_p->SetBasketSize("*", inBasketSize);
+    if(inAutoFlush != 0) slimTree_p->SetAutoFlush(inAutoFlush);
+  }
+
+  inTree_p->SetBranchStatus("*", 1);
+  return slimTree_p;
+}
+
+//JES/JER sys. branch naming in the gdj ntuples; 2024.05.17 _JES_/_JER_ became _JESUp_/_JERUp_
+//Returns 0 for the new naming, 1 for the old, -1 if neither is found
+inline int getJESJERNaming(TTree* inTree_p, int jetR)
+{
+  std::string branchName = "akt" + std::to_string(jetR) + "hi_etajes_jet_pt_sys_JESUp_0";
+  if(inTree_p->FindBranch(branchName.c_str()) != nullptr) return 0;
+
+  branchName.replace(branchName.find("Up"), 2, "");
+  if(inTree_p->FindBranch(branchName.c_str()) != nullptr) return 1;
+
+  return -1;
+}
+
+//Number of JES and JER sys. jet pt branches gdjNTupleToHist reads
+const int nJESSysNTuple = 18;
+const int nJERSysNTuple = 9;
+
+//Branches the gdjNTupleToHist signal loop reads; gdjNTupleToHist and gdjNtupleReadBench both enable exactly these
+//nTruthPhotons is only listed if present (older ntuples store a single truth photon)
+inline std::vector<std::string> getNTupleToHistBranches(TTree* inTree_p, bool isPP, bool isMC, bool doMixPsi2, int jetR, int isolationR, bool isOldJESJER, int nJESSys, int nJERSys)
+{
+  std::vector<std::string> branches;
+  for(auto const & branch : getVectBranchList(inTree_p)){
+    if(branch.find("HLT_") == 0) branches.push_back(branch);
+  }
+
+  branches.push_back("runNumber");
+  branches.push_back("eventNumber");
+  branches.push_back("lumiBlock");
+  branches.push_back("sampleTag");
+
+  if(isMC){
+    branches.push_back("pthat");
+    branches.push_back("sampleWeight");
+    if(!isPP) branches.push_back("ncollWeight");
+    branches.push_back("fullWeight");
+
+    branches.push_back("treePartonId");
+
+    if(inTree_p->FindBranch("nTruthPhotons") != nullptr) branches.push_back("nTruthPhotons");
+    branches.push_back("truthPhotonPt");
+    branches.push_back("truthPhotonEta");
+    branches.push_back("truthPhotonPhi");
+    branches.push_back("truthPhotonIso4");
+  }
+
+  if(!isPP){
+    branches.push_back("is_pileup");
+    branches.push_back("is_oo_pileup");
+
+    branches.push_back("fcalA_et");
+    branches.push_back("fcalC_et");
+    if(doMixPsi2) branches.push_back("evtPlane2Phi");
+  }
+
+  branches.push_back("vert_z");
+
+  branches.push_back("photon_pt");
+  if(isMC){
+    for(Int_t sI = 1; sI <= 4; ++sI){
+      branches.push_back("photon_pt_sys" + std::to_string(sI));
+    }
+  }
+
+  branches.push_back("photon_eta");
+  branches.push_back("photon_phi");
+  branches.push_back("photon_tight");
+  branches.push_back("photon_etcone" + std::to_string(isolationR) + "0");
+  branches.push_back("photon_isem");
+
+  const std::string jetStr = "akt" + std::to_string(jetR);
+  if(isMC){
+    branches.push_back(jetStr + "hi_etajes_jet_pt");
+    branches.push_back(jetStr + "hi_etajes_jet_eta");
+    branches.push_back(jetStr + "hi_etajes_jet_phi");
+
+    const std::string sysStr = isOldJESJER ? "" : "Up";
+    for(Int_t jI = 0; jI < nJESSys; ++jI){
+      branches.push_back(jetStr + "hi_etajes_jet_pt_sys_JES" + sysStr + "_" + std::to_string(jI));
+    }
+    for(Int_t jI = 0; jI < nJERSys; ++jI){
+      branches.push_back(jetStr + "hi_etajes_jet_pt_sys_JER" + sysStr + "_" + std::to_string(jI));
+    }
+  }
+  branches.push_back(jetStr + "hi_insitu_jet_pt");
+  branches.push_back(jetStr + "hi_insitu_jet_eta");
+  branches.push_back(jetStr + "hi_insitu_jet_phi");
+
+  if(isMC){
+    branches.push_back(jetStr + "hi_truthpos");
+
+    branches.push_back(jetStr + "_truth_jet_pt");
+    branches.push_back(jetStr + "_truth_jet_eta");
+    branches.push_back(jetStr + "_truth_jet_phi");
+    branches.push_back(jetStr + "_truth_jet_recopos");
+    branches.push_back(jetStr + "_truth_jet_partonid");
+  }
+
+  return branches;
+}
+
 #endif
@@ -2,7 +2,9 @@
 #define VARUTIL_H
 
 //c+cpp
+#include <iostream>
 #include <string>
+#include <vector>
 
 //ROOT
 #include "TLorentzVector.h"
@@ -11,6 +13,7 @@
 //Local
 #include "include/envUtil.h"
 #include "include/etaPhiFunc.h"
+#include "include/kinVect.h"
 #include "include/stringUtil.h"
 
 inline bool varNameToLabelIsMultijet(std::string varName)
@@ -93,25 +96,137 @@ inline std::string varNameToNLabel(std::string varName)
   return retStr;
 }
 
-inline Double_t getVar(std::string varName, TLorentzVector jet, TLorentzVector jet2, TLorentzVector photon)
+//Observable registry - resolve the var name once at config time, then evaluate via typed function w/o string compares
+enum jetVarType{JETVAR_DPHI = 0, JETVAR_PT, JETVAR_XJ, JETVAR_DPHIJJ, JETVAR_DRJJ, JETVAR_AJJ, JETVAR_XJJ, JETVAR_DPHIJJG, JETVAR_NONE};
+
+inline jetVarType varNameToJetVarType(std::string varName)
 {
-  Double_t jetVar = -1000.0;
-  if(isStrSame(varName, "dphi")) jetVar = TMath::Abs(getDPHI(jet.Phi(), photon.Phi()));
-  else if(isStrSame(varName, "pt")) jetVar = jet.Pt();
-  else if(isStrSame(varName, "xj")) jetVar = jet.Pt()/photon.Pt();
-  else if(isStrSame(varName, "dphijj")) jetVar = TMath::Abs(getDPHI(jet.Phi(), jet2.Phi()));
-  else if(isStrSame(varName, "drjj")) jetVar = getDR(jet.Eta(), jet.Phi(), jet2.Eta(), jet2.Phi());
-  else if(isStrSame(varName, "ajj")) jetVar = (jet.Pt() - jet2.Pt())/photon.Pt();
-  else{
-    jet2 += jet;
-    if(isStrSame(varName, "xjj")) jetVar = jet2.Pt()/photon.Pt();
-    else if(isStrSame(varName, "dphijjg")) jetVar = TMath::Abs(getDPHI(jet2.Phi(), photon.Pt()));
-    else{
-      std::cout << "GETVAR ERROR: varName \'" << varName << "\' is not found. return -1000.0" << std::endl;
+  std::string varNameLower = returnAllLowercaseString(varName);
+  jetVarType retType = JETVAR_NONE;
+
+  if(isStrSame(varNameLower, "dphi")) retType = JETVAR_DPHI;
+  else if(isStrSame(varNameLower, "pt")) retType = JETVAR_PT;
+  else if(isStrSame(varNameLower, "xj")) retType = JETVAR_XJ;
+  else if(isStrSame(varNameLower, "dphijj")) retType = JETVAR_DPHIJJ;
+  else if(isStrSame(varNameLower, "drjj")) retType = JETVAR_DRJJ;
+  else if(isStrSame(varNameLower, "ajj")) retType = JETVAR_AJJ;
+  else if(isStrSame(varNameLower, "xjj")) retType = JETVAR_XJJ;
+  else if(isStrSame(varNameLower, "dphijjg")) retType = JETVAR_DPHIJJG;
+
+  return retType;
+}
+
+//Per type evaluation; jet2 is ignored by single jet vars
+template <int VAR> inline Double_t getJetVar(const kinVect& jet, const kinVect& jet2, const kinVect& photon);
+template <> inline Double_t getJetVar<JETVAR_DPHI>(const kinVect& jet, const kinVect&, const kinVect& photon){return TMath::Abs(getDPHI(jet.Phi(), photon.Phi()));}
+template <> inline Double_t getJetVar<JETVAR_PT>(const kinVect& jet, const kinVect&, const kinVect&){return jet.Pt();}
+template <> inline Double_t getJetVar<JETVAR_XJ>(const kinVect& jet, const kinVect&, const kinVect& photon){return jet.Pt()/photon.Pt();}
+template <> inline Double_t getJetVar<JETVAR_DPHIJJ>(const kinVect& jet, const kinVect& jet2, const kinVect&){return TMath::Abs(getDPHI(jet.Phi(), jet2.Phi()));}
+template <> inline Double_t getJetVar<JETVAR_DRJJ>(const kinVect& jet, const kinVect& jet2, const kinVect&){return getDR(jet.Eta(), jet.Phi(), jet2.Eta(), jet2.Phi());}
+template <> inline Double_t getJetVar<JETVAR_AJJ>(const kinVect& jet, const kinVect& jet2, const kinVect& photon){return (jet.Pt() - jet2.Pt())/photon.Pt();}
+template <> inline Double_t getJetVar<JETVAR_XJJ>(const kinVect& jet, const kinVect& jet2, const kinVect& photon){return (jet2 + jet).Pt()/photon.Pt();}
+template <> inline Double_t getJetVar<JETVAR_DPHIJJG>(const kinVect& jet, const kinVect& jet2, const kinVect& photon){return TMath::Abs(getDPHI((jet2 + jet).Phi(), photon.Pt()));}
+template <> inline Double_t getJetVar<JETVAR_NONE>(const kinVect&, const kinVect&, const kinVect&){return -1000.0;}
+
+//Batch versions, one call per event; pairs are (jI, jI2 > jI) in loop order, see jetVar::GetPairPos
+template <int VAR> inline void getJetVarForJets(const std::vector<kinVect>& jets, const kinVect& photon, std::vector<Double_t>* out_vals)
+{
+  out_vals->resize(jets.size());
+  for(unsigned int jI = 0; jI < jets.size(); ++jI){
+    (*out_vals)[jI] = getJetVar<VAR>(jets[jI], jets[jI], photon);
+  }
+  return;
+}
+
+template <int VAR> inline void getJetVarForPairs(const std::vector<kinVect>& jets, const kinVect& photon, std::vector<Double_t>* out_vals)
+{
+  const unsigned int nJets = jets.size();
+  out_vals->resize(nJets > 1 ? nJets*(nJets - 1)/2 : 0);
+  unsigned int pairPos = 0;
+  for(unsigned int jI = 0; jI < nJets; ++jI){
+    for(unsigned int jI2 = jI+1; jI2 < nJets; ++jI2){
+      (*out_vals)[pairPos] = getJetVar<VAR>(jets[jI], jets[jI2], photon);
+      ++pairPos;
     }
   }
-  return jetVar;
+  return;
+}
+
+class jetVar{
+ public:
+  typedef Double_t (*varFunc)(const kinVect&, const kinVect&, const kinVect&);
+  typedef void (*batchFunc)(const std::vector<kinVect>&, const kinVect&, std::vector<Double_t>*);
+
+  jetVar(){Init(JETVAR_NONE);}
+  jetVar(std::string in_varName){Init(in_varName);}
+
+  bool Init(std::string in_varName)
+  {
+    Init(varNameToJetVarType(in_varName));
+    if(m_type != JETVAR_NONE) return true;
+
+    std::cout << "jetVar::Init() error - Var \'" << in_varName << "\' not found. please add. return false" << std::endl;
+    return false;
+  }
+
+  void Init(jetVarType in_type)
+  {
+    m_type = in_type;
+    m_isMultijet = in_type == JETVAR_DPHIJJ || in_type == JETVAR_DRJJ || in_type == JETVAR_AJJ || in_type == JETVAR_XJJ || in_type == JETVAR_DPHIJJG;
+
+    if(in_type == JETVAR_DPHI) SetFuncs<JETVAR_DPHI>();
+    else if(in_type == JETVAR_PT) SetFuncs<JETVAR_PT>();
+    else if(in_type == JETVAR_XJ) SetFuncs<JETVAR_XJ>();
+    else if(in_type == JETVAR_DPHIJJ) SetFuncs<JETVAR_DPHIJJ>();
+    else if(in_type == JETVAR_DRJJ) SetFuncs<JETVAR_DRJJ>();
+    else if(in_type == JETVAR_AJJ) SetFuncs<JETVAR_AJJ>();
+    else if(in_type == JETVAR_XJJ) SetFuncs<JETVAR_XJJ>();
+    else if(in_type == JETVAR_DPHIJJG) SetFuncs<JETVAR_DPHIJJG>();
+    else SetFuncs<JETVAR_NONE>();
+    return;
+  }
+
+  bool IsInit() const {return m_type != JETVAR_NONE;}
+  bool IsMultijet() const {return m_isMultijet;}
+  jetVarType GetType() const {return m_type;}
+
+  Double_t operator()(const kinVect& jet, const kinVect& jet2, const kinVect& photon) const {return m_varFunc(jet, jet2, photon);}
+  //Var for each jet, i.e. (jet, jet, photon)
+  void EvalJets(const std::vector<kinVect>& jets, const kinVect& photon, std::vector<Double_t>* out_vals) const {m_jetsFunc(jets, photon, out_vals);}
+  //Var for each jet pair, index w/ GetPairPos
+  void EvalPairs(const std::vector<kinVect>& jets, const kinVect& photon, std::vector<Double_t>* out_vals) const {m_pairsFunc(jets, photon, out_vals);}
+
+  static unsigned int GetPairPos(unsigned int jI, unsigned int jI2, unsigned int nJets){return jI*(2*nJets - jI - 1)/2 + (jI2 - jI - 1);}
+
+ private:
+  template <int VAR> void SetFuncs()
+  {
+    m_varFunc = &getJetVar<VAR>;
+    m_jetsFunc = &getJetVarForJets<VAR>;
+    m_pairsFunc = &getJetVarForPairs<VAR>;
+    return;
+  }
+
+  jetVarType m_type = JETVAR_NONE;
+  bool m_isMultijet = false;
+  varFunc m_varFunc = nullptr;
+  batchFunc m_jetsFunc = nullptr;
+  batchFunc m_pairsFunc = nullptr;
+};
+
+//String lookup per call, prefer a jetVar built once outside of loops
+inline Double_t getVar(std::string varName, const kinVect& jet, const kinVect& jet2, const kinVect& photon)
+{
+  jetVar var;
+  var.Init(varNameToJetVarType(varName));
+  if(!var.IsInit()) std::cout << "GETVAR ERROR: varName \'" << varName << "\' is not found. return -1000.0" << std::endl;
+  return var(jet, jet2, photon);
 }
 
+//TLorentzVector shim for callers not yet on kinVect
+inline Double_t getVar(std::string varName, const TLorentzVector& jet, const TLorentzVector& jet2, const TLorentzVector& photon)
+{
+  return getVar(varName, kinVect(jet), kinVect(jet2), kinVect(photon));
+}
 
 #endif